@@ -0,0 +1,713 @@
+/**
+ * @file GCourtierContentionBenchmark.cpp
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+/**
+ * This program measures throughput and latency of the hot paths through which
+ * work items travel inside of the courtier library: GBoundedBufferT, GBufferPortT,
+ * GBrokerT and GThreadPool. It sweeps the number of producer- and consumer-threads,
+ * the payload size of work items and (where applicable) the buffer capacity. Results
+ * are printed to the console and written to a JSON file, so that changes to these
+ * components may be quantified and regressions detected.
+ */
+
+// Standard headers go here
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <future>
+#include <memory>
+#include <functional>
+
+// Geneva headers go here
+#include "common/GBoundedBufferT.hpp"
+#include "common/GThreadPool.hpp"
+#include "common/GBarrier.hpp"
+#include "common/GExceptions.hpp"
+#include "common/GParserBuilder.hpp"
+#include "common/GCommonHelperFunctions.hpp"
+#include "courtier/GBufferPortT.hpp"
+#include "courtier/GBrokerT.hpp"
+#include "courtier/GDemoProcessingContainers.hpp"
+
+using namespace Gem::Common;
+using namespace Gem::Courtier;
+
+using bench_clock = std::chrono::high_resolution_clock;
+
+/********************************************************************************/
+// Default settings
+const std::string DEFAULTCOMPONENTS = "buffer,bufferport,broker,threadpool";
+const std::string DEFAULTNPRODUCERS = "1,2,4";
+const std::string DEFAULTNCONSUMERS = "1,2,4";
+const std::string DEFAULTPAYLOADSIZES = "0,100,10000";
+const std::string DEFAULTCAPACITIES = "10,100,1000,5000";
+const std::size_t DEFAULTNITEMSPERPRODUCER = 20000;
+const long DEFAULTGETTIMEOUTMS = 1;
+const std::string DEFAULTJSONOUTPUT = "GCourtierContentionBenchmark.json";
+
+/********************************************************************************/
+/**
+ * Holds the settings of the benchmark, as read from the command line
+ */
+struct benchmark_config {
+	std::vector<std::string> components;
+	std::vector<unsigned int> nProducers;
+	std::vector<unsigned int> nConsumers;
+	std::vector<unsigned int> payloadSizes;
+	std::vector<unsigned int> capacities;
+	std::size_t nItemsPerProducer = DEFAULTNITEMSPERPRODUCER;
+	std::chrono::milliseconds getTimeout{DEFAULTGETTIMEOUTMS};
+	std::string jsonOutput = DEFAULTJSONOUTPUT;
+};
+
+/********************************************************************************/
+/**
+ * Holds the results of a single benchmark configuration
+ */
+struct benchmark_result {
+	std::string component;
+	std::size_t nProducers = 0;
+	std::size_t nConsumers = 0;
+	std::size_t payloadSize = 0;
+	std::size_t capacity = 0;
+	std::size_t nItems = 0;
+	double wallTime_s = 0.;
+	double throughput_items_per_s = 0.;
+	double latency_p50_us = 0.;
+	double latency_p99_us = 0.;
+};
+
+/********************************************************************************/
+/**
+ * The work item passed through GBoundedBufferT and GThreadPool. It carries its
+ * own submission time, so latencies can be determined at the receiving end.
+ */
+struct buffer_item {
+	explicit buffer_item(std::size_t payloadSize)
+		: payload(payloadSize, 1.)
+	{ /* nothing */ }
+
+	bench_clock::time_point submission_time;
+	std::vector<double> payload;
+};
+
+using buffer_item_ptr = std::shared_ptr<buffer_item>;
+
+/********************************************************************************/
+/**
+ * Converts a duration to (floating point) microseconds
+ */
+double to_us(bench_clock::duration const& d) {
+	return std::chrono::duration<double, std::micro>(d).count();
+}
+
+/********************************************************************************/
+/**
+ * Retrieves a given percentile from a collection of latencies. The collection
+ * is partially sorted in the process.
+ */
+double percentile(std::vector<double>& latencies, double p) {
+	if(latencies.empty()) return 0.;
+
+	auto pos = static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1));
+	std::nth_element(latencies.begin(), latencies.begin() + pos, latencies.end());
+	return latencies[pos];
+}
+
+/********************************************************************************/
+/**
+ * Fills the timing-related fields of a result object
+ */
+void fill_timings(
+	benchmark_result& r
+	, bench_clock::time_point const& start
+	, bench_clock::time_point const& end
+	, std::vector<std::vector<double>>& latencies_per_thread
+) {
+	std::vector<double> latencies;
+	for(auto const& l: latencies_per_thread) {
+		latencies.insert(latencies.end(), l.begin(), l.end());
+	}
+
+	r.wallTime_s = std::chrono::duration<double>(end - start).count();
+	r.throughput_items_per_s = r.wallTime_s > 0. ? static_cast<double>(r.nItems) / r.wallTime_s : 0.;
+	r.latency_p50_us = percentile(latencies, 0.50);
+	r.latency_p99_us = percentile(latencies, 0.99);
+}
+
+/********************************************************************************/
+/**
+ * Measures a GBoundedBufferT with a given (compile-time) capacity. Producers push
+ * items into the buffer, consumers take them out again. The latency is the time
+ * between submission and retrieval of an item.
+ */
+template <std::size_t capacity>
+benchmark_result run_bounded_buffer(
+	std::size_t nProducers
+	, std::size_t nConsumers
+	, std::size_t payloadSize
+	, benchmark_config const& cfg
+) {
+	GBoundedBufferT<buffer_item_ptr, capacity> buffer;
+
+	benchmark_result r;
+	r.component = "GBoundedBufferT";
+	r.nProducers = nProducers;
+	r.nConsumers = nConsumers;
+	r.payloadSize = payloadSize;
+	r.capacity = capacity;
+	r.nItems = nProducers * cfg.nItemsPerProducer;
+
+	std::atomic<std::size_t> nConsumed{0};
+	std::vector<std::vector<double>> latencies(nConsumers);
+	bench_clock::time_point end;
+	GBarrier barrier(static_cast<std::uint32_t>(nProducers + nConsumers + 1));
+
+	std::vector<std::thread> threads;
+	for(std::size_t p=0; p<nProducers; p++) {
+		threads.emplace_back([&]() {
+			// Items are created before the measurement starts
+			std::vector<buffer_item_ptr> items;
+			for(std::size_t i=0; i<cfg.nItemsPerProducer; i++) {
+				items.push_back(std::make_shared<buffer_item>(payloadSize));
+			}
+
+			barrier.wait();
+
+			for(auto& item_ptr: items) {
+				item_ptr->submission_time = bench_clock::now();
+				buffer.push_and_block_move(std::move(item_ptr));
+			}
+		});
+	}
+
+	for(std::size_t c=0; c<nConsumers; c++) {
+		threads.emplace_back([&, c]() {
+			latencies[c].reserve(r.nItems);
+			buffer_item_ptr item_ptr;
+
+			barrier.wait();
+
+			while(nConsumed.load() < r.nItems) {
+				if(buffer.pop_and_wait_move(item_ptr, cfg.getTimeout)) {
+					latencies[c].push_back(to_us(bench_clock::now() - item_ptr->submission_time));
+					item_ptr.reset();
+					if(++nConsumed == r.nItems) end = bench_clock::now();
+				}
+			}
+		});
+	}
+
+	barrier.wait();
+	auto start = bench_clock::now();
+	for(auto& t: threads) t.join();
+
+	fill_timings(r, start, end, latencies);
+	return r;
+}
+
+/********************************************************************************/
+/**
+ * Translates a run-time capacity into one of the compile-time capacities
+ * supported by GBoundedBufferT in this benchmark
+ */
+benchmark_result run_bounded_buffer(
+	std::size_t nProducers
+	, std::size_t nConsumers
+	, std::size_t payloadSize
+	, std::size_t capacity
+	, benchmark_config const& cfg
+) {
+	switch(capacity) {
+		case 0: return run_bounded_buffer<0>(nProducers, nConsumers, payloadSize, cfg);
+		case 1: return run_bounded_buffer<1>(nProducers, nConsumers, payloadSize, cfg);
+		case 10: return run_bounded_buffer<10>(nProducers, nConsumers, payloadSize, cfg);
+		case 100: return run_bounded_buffer<100>(nProducers, nConsumers, payloadSize, cfg);
+		case 1000: return run_bounded_buffer<1000>(nProducers, nConsumers, payloadSize, cfg);
+		case 5000: return run_bounded_buffer<5000>(nProducers, nConsumers, payloadSize, cfg);
+		case 10000: return run_bounded_buffer<10000>(nProducers, nConsumers, payloadSize, cfg);
+		default:
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In run_bounded_buffer(): Error!" << std::endl
+					<< "Unsupported capacity " << capacity << std::endl
+					<< "Supported values are 0, 1, 10, 100, 1000, 5000 and 10000" << std::endl
+			);
+	}
+}
+
+/********************************************************************************/
+/**
+ * Creates the work items for a single producer of the GBufferPortT- and
+ * GBrokerT-benchmarks
+ */
+std::vector<std::shared_ptr<GRandomNumberContainer>> create_containers(
+	std::size_t nItems
+	, std::size_t payloadSize
+) {
+	std::vector<std::shared_ptr<GRandomNumberContainer>> items;
+	for(std::size_t i=0; i<nItems; i++) {
+		items.push_back(std::make_shared<GRandomNumberContainer>(payloadSize));
+	}
+	return items;
+}
+
+/********************************************************************************/
+/**
+ * Measures the round trip of work items through a single GBufferPortT. Producers
+ * submit all of their items to the raw queue and then wait for the same number of
+ * processed items, like an executor does. Consumers shuffle items from the raw
+ * to the processed queue. The latency is the full round trip.
+ */
+benchmark_result run_buffer_port(
+	std::size_t nProducers
+	, std::size_t nConsumers
+	, std::size_t payloadSize
+	, benchmark_config const& cfg
+) {
+	GBufferPortT<GRandomNumberContainer> port;
+
+	benchmark_result r;
+	r.component = "GBufferPortT";
+	r.nProducers = nProducers;
+	r.nConsumers = nConsumers;
+	r.payloadSize = payloadSize;
+	r.capacity = DEFAULTBUFFERSIZE;
+	r.nItems = nProducers * cfg.nItemsPerProducer;
+
+	std::atomic<std::size_t> nProcessed{0};
+	std::vector<std::vector<double>> latencies(nProducers);
+	GBarrier barrier(static_cast<std::uint32_t>(nProducers + nConsumers + 1));
+
+	std::vector<std::thread> producers;
+	for(std::size_t p=0; p<nProducers; p++) {
+		producers.emplace_back([&, p]() {
+			auto items = create_containers(cfg.nItemsPerProducer, payloadSize);
+			latencies[p].reserve(cfg.nItemsPerProducer);
+
+			barrier.wait();
+
+			for(auto const& item_ptr: items) port.push_raw(item_ptr);
+			items.clear();
+
+			std::shared_ptr<GRandomNumberContainer> item_ptr;
+			for(std::size_t i=0; i<cfg.nItemsPerProducer; i++) {
+				port.pop_processed(item_ptr);
+				latencies[p].push_back(to_us(item_ptr->getProcRetrievalTime() - item_ptr->getRawSubmissionTime()));
+			}
+		});
+	}
+
+	std::vector<std::thread> consumers;
+	for(std::size_t c=0; c<nConsumers; c++) {
+		consumers.emplace_back([&]() {
+			std::shared_ptr<GRandomNumberContainer> item_ptr;
+
+			barrier.wait();
+
+			while(nProcessed.load() < r.nItems) {
+				if(port.pop_raw(item_ptr, cfg.getTimeout)) {
+					port.push_processed(item_ptr);
+					item_ptr.reset();
+					nProcessed++;
+				}
+			}
+		});
+	}
+
+	barrier.wait();
+	auto start = bench_clock::now();
+	for(auto& t: producers) t.join();
+	auto end = bench_clock::now();
+	for(auto& t: consumers) t.join();
+
+	fill_timings(r, start, end, latencies);
+	return r;
+}
+
+/********************************************************************************/
+/**
+ * Measures the round trip of work items through a GBrokerT. Each producer enrols
+ * its own buffer port, just like GBrokerExecutorT does, and consumer threads retrieve
+ * items through the broker's round-robin get() and return them through put().
+ */
+benchmark_result run_broker(
+	std::size_t nProducers
+	, std::size_t nConsumers
+	, std::size_t payloadSize
+	, benchmark_config const& cfg
+) {
+	GBrokerT<GRandomNumberContainer> broker;
+
+	benchmark_result r;
+	r.component = "GBrokerT";
+	r.nProducers = nProducers;
+	r.nConsumers = nConsumers;
+	r.payloadSize = payloadSize;
+	r.capacity = DEFAULTBUFFERSIZE;
+	r.nItems = nProducers * cfg.nItemsPerProducer;
+
+	std::vector<std::shared_ptr<GBufferPortT<GRandomNumberContainer>>> ports;
+	for(std::size_t p=0; p<nProducers; p++) {
+		ports.push_back(std::make_shared<GBufferPortT<GRandomNumberContainer>>());
+		broker.enrol_buffer_port(ports.back());
+	}
+
+	std::atomic<std::size_t> nProcessed{0};
+	std::vector<std::vector<double>> latencies(nProducers);
+	GBarrier barrier(static_cast<std::uint32_t>(nProducers + nConsumers + 1));
+
+	std::vector<std::thread> producers;
+	for(std::size_t p=0; p<nProducers; p++) {
+		producers.emplace_back([&, p]() {
+			auto items = create_containers(cfg.nItemsPerProducer, payloadSize);
+			latencies[p].reserve(cfg.nItemsPerProducer);
+
+			barrier.wait();
+
+			for(auto const& item_ptr: items) ports[p]->push_raw(item_ptr);
+			items.clear();
+
+			std::shared_ptr<GRandomNumberContainer> item_ptr;
+			for(std::size_t i=0; i<cfg.nItemsPerProducer; i++) {
+				ports[p]->pop_processed(item_ptr);
+				latencies[p].push_back(to_us(item_ptr->getProcRetrievalTime() - item_ptr->getRawSubmissionTime()));
+			}
+		});
+	}
+
+	std::vector<std::thread> consumers;
+	for(std::size_t c=0; c<nConsumers; c++) {
+		consumers.emplace_back([&]() {
+			std::shared_ptr<GRandomNumberContainer> item_ptr;
+
+			barrier.wait();
+
+			while(nProcessed.load() < r.nItems) {
+				if(broker.get(item_ptr, cfg.getTimeout)) {
+					broker.put(item_ptr);
+					item_ptr.reset();
+					nProcessed++;
+				}
+			}
+		});
+	}
+
+	barrier.wait();
+	auto start = bench_clock::now();
+	for(auto& t: producers) t.join();
+	auto end = bench_clock::now();
+	for(auto& t: consumers) t.join();
+
+	for(auto const& port_ptr: ports) port_ptr->producer_disconnect();
+
+	fill_timings(r, start, end, latencies);
+	return r;
+}
+
+/********************************************************************************/
+/**
+ * Measures the submission of tasks to a GThreadPool. The number of consumers
+ * is the number of threads in the pool. The latency is the time between
+ * submission of a task and the start of its execution.
+ */
+benchmark_result run_thread_pool(
+	std::size_t nProducers
+	, std::size_t nConsumers
+	, std::size_t payloadSize
+	, benchmark_config const& cfg
+) {
+	GThreadPool pool(static_cast<unsigned int>(nConsumers));
+
+	benchmark_result r;
+	r.component = "GThreadPool";
+	r.nProducers = nProducers;
+	r.nConsumers = nConsumers;
+	r.payloadSize = payloadSize;
+	r.capacity = 0; // The pool's queue is unbounded
+	r.nItems = nProducers * cfg.nItemsPerProducer;
+
+	// Make sure the pool's threads have been started before we measure
+	pool.async_schedule([](){ /* nothing */ }).get();
+
+	// Every task writes into its own slot, so recording latencies needs no synchronization
+	std::vector<std::vector<double>> latencies(nProducers, std::vector<double>(cfg.nItemsPerProducer, 0.));
+	GBarrier barrier(static_cast<std::uint32_t>(nProducers + 1));
+
+	std::vector<std::thread> producers;
+	for(std::size_t p=0; p<nProducers; p++) {
+		producers.emplace_back([&, p]() {
+			std::vector<buffer_item_ptr> items;
+			for(std::size_t i=0; i<cfg.nItemsPerProducer; i++) {
+				items.push_back(std::make_shared<buffer_item>(payloadSize));
+			}
+			std::vector<std::future<void>> futures;
+			futures.reserve(cfg.nItemsPerProducer);
+
+			barrier.wait();
+
+			for(std::size_t i=0; i<cfg.nItemsPerProducer; i++) {
+				auto item_ptr = items[i];
+				double *latency_ptr = &latencies[p][i];
+				item_ptr->submission_time = bench_clock::now();
+				futures.push_back(pool.async_schedule([item_ptr, latency_ptr]() {
+					*latency_ptr = to_us(bench_clock::now() - item_ptr->submission_time);
+				}));
+			}
+
+			for(auto& f: futures) f.get();
+		});
+	}
+
+	barrier.wait();
+	auto start = bench_clock::now();
+	for(auto& t: producers) t.join();
+	auto end = bench_clock::now();
+
+	fill_timings(r, start, end, latencies);
+	return r;
+}
+
+/********************************************************************************/
+/**
+ * Writes the collected results to a JSON file
+ */
+void write_json_results(
+	std::string const& fileName
+	, std::vector<benchmark_result> const& results
+) {
+	std::ofstream ofs(fileName);
+	if(not ofs) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In write_json_results(): Error!" << std::endl
+				<< "Could not open file " << fileName << " for writing" << std::endl
+		);
+	}
+
+	ofs
+		<< "{" << std::endl
+		<< "  \"benchmark\": \"GCourtierContentionBenchmark\"," << std::endl
+		<< "  \"hardwareThreads\": " << getNHardwareThreads() << "," << std::endl
+		<< "  \"results\": [" << std::endl;
+
+	for(std::size_t i=0; i<results.size(); i++) {
+		auto const& r = results[i];
+		ofs
+			<< "    {"
+			<< "\"component\": \"" << r.component << "\", "
+			<< "\"nProducers\": " << r.nProducers << ", "
+			<< "\"nConsumers\": " << r.nConsumers << ", "
+			<< "\"payloadSize\": " << r.payloadSize << ", "
+			<< "\"capacity\": " << r.capacity << ", "
+			<< "\"nItems\": " << r.nItems << ", "
+			<< "\"wallTime_s\": " << r.wallTime_s << ", "
+			<< "\"throughput_items_per_s\": " << r.throughput_items_per_s << ", "
+			<< "\"latency_p50_us\": " << r.latency_p50_us << ", "
+			<< "\"latency_p99_us\": " << r.latency_p99_us
+			<< "}" << (i+1 < results.size() ? "," : "") << std::endl;
+	}
+
+	ofs
+		<< "  ]" << std::endl
+		<< "}" << std::endl;
+}
+
+/********************************************************************************/
+/**
+ * Prints a single result to the console
+ */
+void print_result(benchmark_result const& r) {
+	std::cout
+		<< std::left << std::setw(16) << r.component << std::right
+		<< " prod=" << std::setw(3) << r.nProducers
+		<< " cons=" << std::setw(3) << r.nConsumers
+		<< " payload=" << std::setw(7) << r.payloadSize
+		<< " cap=" << std::setw(6) << r.capacity
+		<< " | " << std::setw(12) << std::fixed << std::setprecision(0) << r.throughput_items_per_s << " items/s"
+		<< " | p50 " << std::setw(10) << std::setprecision(2) << r.latency_p50_us << " us"
+		<< " | p99 " << std::setw(10) << r.latency_p99_us << " us"
+		<< std::defaultfloat << std::endl;
+}
+
+/********************************************************************************/
+/**
+ * A function that parses the command line for all required parameters
+ */
+bool parseCommandLine(
+	int argc, char **argv
+	, benchmark_config& cfg
+) {
+	std::string components, nProducers, nConsumers, payloadSizes, capacities;
+	long getTimeoutMS = DEFAULTGETTIMEOUTMS;
+
+	// Create the parser builder
+	Gem::Common::GParserBuilder gpb;
+
+	gpb.registerCLParameter<std::string>(
+		"components,m"
+		, components
+		, DEFAULTCOMPONENTS
+		, "A comma-separated list of components to measure (buffer, bufferport, broker, threadpool)"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"nProducers,p"
+		, nProducers
+		, DEFAULTNPRODUCERS
+		, "A comma-separated list of producer thread counts"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"nConsumers,c"
+		, nConsumers
+		, DEFAULTNCONSUMERS
+		, "A comma-separated list of consumer thread counts"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"payloadSizes,s"
+		, payloadSizes
+		, DEFAULTPAYLOADSIZES
+		, "A comma-separated list of payload sizes (number of doubles per work item)"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"capacities,b"
+		, capacities
+		, DEFAULTCAPACITIES
+		, "A comma-separated list of GBoundedBufferT capacities (0, 1, 10, 100, 1000, 5000 or 10000)"
+	);
+
+	gpb.registerCLParameter<std::size_t>(
+		"nItemsPerProducer,n"
+		, cfg.nItemsPerProducer
+		, DEFAULTNITEMSPERPRODUCER
+		, "The number of work items submitted by each producer"
+	);
+
+	gpb.registerCLParameter<long>(
+		"getTimeoutMS,g"
+		, getTimeoutMS
+		, DEFAULTGETTIMEOUTMS
+		, "The timeout used by consumers when retrieving items"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"jsonOutput,j"
+		, cfg.jsonOutput
+		, DEFAULTJSONOUTPUT
+		, "The name of the file to which JSON results should be written"
+	);
+
+	// Parse the command line and leave if the help flag was given. The parser
+	// will emit an appropriate help message by itself
+	if(Gem::Common::GCL_HELP_REQUESTED == gpb.parseCommandLine(argc, argv, true /*verbose*/)) {
+		return false; // Do not continue
+	}
+
+	cfg.components = Gem::Common::splitString(components, ",");
+	cfg.nProducers = Gem::Common::stringToUIntVec(nProducers);
+	cfg.nConsumers = Gem::Common::stringToUIntVec(nConsumers);
+	cfg.payloadSizes = Gem::Common::stringToUIntVec(payloadSizes);
+	cfg.capacities = Gem::Common::stringToUIntVec(capacities);
+	cfg.getTimeout = std::chrono::milliseconds(getTimeoutMS);
+
+	return true;
+}
+
+/********************************************************************************/
+
+int main(int argc, char **argv) {
+	benchmark_config cfg;
+
+	//--------------------------------------------------------------------------------
+	// Find out about our configuration options
+	if(not parseCommandLine(argc, argv, cfg)) { exit(0); }
+
+	auto wanted = [&cfg](std::string const& component) -> bool {
+		return std::find(cfg.components.begin(), cfg.components.end(), component) != cfg.components.end();
+	};
+
+	//--------------------------------------------------------------------------------
+	// Sweep all requested configurations
+	std::vector<benchmark_result> results;
+
+	for(auto nProducers: cfg.nProducers) {
+		for(auto nConsumers: cfg.nConsumers) {
+			for(auto payloadSize: cfg.payloadSizes) {
+				if(wanted("buffer")) {
+					for(auto capacity: cfg.capacities) {
+						results.push_back(run_bounded_buffer(nProducers, nConsumers, payloadSize, capacity, cfg));
+						print_result(results.back());
+					}
+				}
+
+				if(wanted("bufferport")) {
+					results.push_back(run_buffer_port(nProducers, nConsumers, payloadSize, cfg));
+					print_result(results.back());
+				}
+
+				if(wanted("broker")) {
+					results.push_back(run_broker(nProducers, nConsumers, payloadSize, cfg));
+					print_result(results.back());
+				}
+
+				if(wanted("threadpool")) {
+					results.push_back(run_thread_pool(nProducers, nConsumers, payloadSize, cfg));
+					print_result(results.back());
+				}
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------------------
+	// Store the results for later comparison
+	write_json_results(cfg.jsonOutput, results);
+	std::cout << "Results were written to " << cfg.jsonOutput << std::endl;
+
+	//--------------------------------------------------------------------------------
+}
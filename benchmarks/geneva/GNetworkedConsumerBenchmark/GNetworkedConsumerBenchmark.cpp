@@ -0,0 +1,430 @@
+/**
+ * @file GNetworkedConsumerBenchmark.cpp
+ */
+
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+/**
+ * This program measures the end-to-end performance of the broker infrastructure
+ * for a given consumer. In server mode it repeatedly submits a population of
+ * GDelayIndividual objects through a GBrokerExecutorT, whose evaluation times
+ * are drawn from a configurable distribution and whose payload size may be
+ * chosen freely. It reports generations/s, items/s, the number of bytes sent
+ * over the loopback interface as well as broker-side latency percentiles.
+ * In client mode it simply processes work items. The script runLoopbackCluster.sh
+ * starts one server plus N clients on the local host for the networked consumers.
+ */
+
+// Standard header files go here
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// Boost header files go here
+
+// Geneva header files go here
+#include "common/GSerializationHelperFunctionsT.hpp"
+#include "courtier/GExecutorT.hpp"
+#include "geneva/Go2.hpp"
+#include "geneva/GDoubleCollection.hpp"
+
+// The individual that is sent through the broker
+#include "geneva-individuals/GDelayIndividual.hpp"
+
+using namespace Gem::Geneva;
+using namespace Gem::Courtier;
+namespace po = boost::program_options;
+
+using bench_clock = std::chrono::high_resolution_clock;
+
+/******************************************************************************/
+// Default settings
+const std::uint32_t DEFAULTNGENERATIONS = 20;
+const std::size_t DEFAULTBENCHPOPULATIONSIZE = 100;
+const std::size_t DEFAULTNVARIABLES = 100;
+const std::string DEFAULTEVALDISTRIBUTION = "fixed";
+const double DEFAULTEVALTIME = 0.01;
+const double DEFAULTEVALSPREAD = 0.005;
+const double DEFAULTWAITFACTOR = 0.; // Wait for the full return of all items
+const std::string DEFAULTLABEL = "";
+const std::string DEFAULTJSONOUTPUT = "GNetworkedConsumerBenchmark.json";
+
+/******************************************************************************/
+/**
+ * Draws evaluation times (in seconds) for GDelayIndividual objects. Supported
+ * distributions are "fixed" (always the mean), "uniform" (mean +/- spread),
+ * "normal" (standard deviation = spread) and "exponential" (spread is ignored).
+ * Negative values are clipped to 0.
+ */
+class eval_time_distribution {
+public:
+	 eval_time_distribution(std::string const& name, double mean, double spread)
+		 : m_name(name)
+		 , m_mean(mean)
+		 , m_spread(spread)
+	 {
+		 if(
+			 "fixed" != m_name
+			 && "uniform" != m_name
+			 && "normal" != m_name
+			 && "exponential" != m_name
+		 ) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In eval_time_distribution::eval_time_distribution(): Error!" << std::endl
+					 << "Unknown distribution \"" << m_name << "\"" << std::endl
+			 );
+		 }
+
+		 if(m_mean < 0. || m_spread < 0.) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In eval_time_distribution::eval_time_distribution(): Error!" << std::endl
+					 << "Got negative mean " << m_mean << " or spread " << m_spread << std::endl
+			 );
+		 }
+	 }
+
+	 double operator()() {
+		 double t = m_mean;
+
+		 if("uniform" == m_name) {
+			 t = std::uniform_real_distribution<double>(m_mean - m_spread, m_mean + m_spread)(m_rng);
+		 } else if("normal" == m_name) {
+			 t = std::normal_distribution<double>(m_mean, m_spread)(m_rng);
+		 } else if("exponential" == m_name && m_mean > 0.) {
+			 t = std::exponential_distribution<double>(1./m_mean)(m_rng);
+		 }
+
+		 return (std::max)(t, 0.);
+	 }
+
+private:
+	 std::string m_name;
+	 double m_mean;
+	 double m_spread;
+	 std::mt19937 m_rng{42}; // Fixed seed so runs with different consumers see the same evaluation times
+};
+
+/******************************************************************************/
+/**
+ * Retrieves the number of bytes transmitted over the loopback interface so far.
+ * As every byte sent over "lo" is also received over "lo", only the transmitted
+ * bytes are counted. Returns 0 if the information is not available (e.g. on
+ * systems without /proc/net/dev).
+ */
+std::uint64_t loopback_tx_bytes() {
+	std::ifstream ifs("/proc/net/dev");
+	std::string line;
+
+	while(std::getline(ifs, line)) {
+		auto colon_pos = line.find(':');
+		if(std::string::npos == colon_pos) continue;
+
+		std::string iface = line.substr(0, colon_pos);
+		iface.erase(std::remove(iface.begin(), iface.end(), ' '), iface.end());
+		if("lo" != iface) continue;
+
+		// Receive: bytes packets errs drop fifo frame compressed multicast, Transmit: bytes ...
+		std::istringstream iss(line.substr(colon_pos + 1));
+		std::uint64_t value = 0, tx_bytes = 0;
+		for(std::size_t i=0; i<9 && (iss >> value); i++) {
+			if(8 == i) tx_bytes = value;
+		}
+
+		return tx_bytes;
+	}
+
+	return 0;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves a given percentile from a collection of latencies. The collection
+ * is partially sorted in the process.
+ */
+double percentile(std::vector<double>& latencies, double p) {
+	if(latencies.empty()) return 0.;
+
+	auto pos = static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1));
+	std::nth_element(latencies.begin(), latencies.begin() + pos, latencies.end());
+	return latencies[pos];
+}
+
+/******************************************************************************/
+/**
+ * Converts a duration to (floating point) milliseconds
+ */
+double to_ms(bench_clock::duration const& d) {
+	return std::chrono::duration<double, std::milli>(d).count();
+}
+
+/******************************************************************************/
+/**
+ * Collects broker-side latencies of processed work items
+ */
+struct latency_collector {
+	 std::vector<double> roundTrip_ms; ///< Submission to the buffer port until retrieval of the processed item
+	 std::vector<double> queueWait_ms; ///< Submission to the buffer port until a consumer picked up the item
+	 std::vector<double> overhead_ms;  ///< Round trip minus the time spent in processing on the client side
+
+	 void add(std::shared_ptr<GParameterSet> const& p) {
+		 double roundTrip = to_ms(p->getProcRetrievalTime() - p->getRawSubmissionTime());
+		 double queueWait = to_ms(p->getRawRetrievalTime() - p->getRawSubmissionTime());
+
+		 auto processingTimes = p->getProcessingTimes();
+		 double processing = 1000.*(std::get<0>(processingTimes) + std::get<1>(processingTimes) + std::get<2>(processingTimes));
+
+		 roundTrip_ms.push_back(roundTrip);
+		 queueWait_ms.push_back(queueWait);
+		 overhead_ms.push_back(roundTrip - processing);
+	 }
+};
+
+/******************************************************************************/
+/**
+ * Writes the results of a run to a JSON file
+ */
+void write_json_results(
+	std::string const& fileName
+	, std::string const& label
+	, std::uint32_t nGenerations
+	, std::size_t populationSize
+	, std::size_t nVariables
+	, std::string const& evalDistribution
+	, double evalTime
+	, double evalSpread
+	, double waitFactor
+	, double wallTime_s
+	, std::size_t nProcessedItems
+	, std::size_t nUnprocessedItems
+	, std::size_t serializedItemSize
+	, std::uint64_t bytesOnWire
+	, latency_collector& lc
+) {
+	std::ofstream ofs(fileName);
+	if(not ofs) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In write_json_results(): Error!" << std::endl
+				<< "Could not open file " << fileName << " for writing" << std::endl
+		);
+	}
+
+	ofs
+		<< "{" << std::endl
+		<< "  \"benchmark\": \"GNetworkedConsumerBenchmark\"," << std::endl
+		<< "  \"consumer\": \"" << label << "\"," << std::endl
+		<< "  \"nGenerations\": " << nGenerations << "," << std::endl
+		<< "  \"populationSize\": " << populationSize << "," << std::endl
+		<< "  \"nVariables\": " << nVariables << "," << std::endl
+		<< "  \"evalDistribution\": \"" << evalDistribution << "\"," << std::endl
+		<< "  \"evalTime_s\": " << evalTime << "," << std::endl
+		<< "  \"evalSpread_s\": " << evalSpread << "," << std::endl
+		<< "  \"waitFactor\": " << waitFactor << "," << std::endl
+		<< "  \"wallTime_s\": " << wallTime_s << "," << std::endl
+		<< "  \"generations_per_s\": " << (wallTime_s > 0. ? double(nGenerations) / wallTime_s : 0.) << "," << std::endl
+		<< "  \"items_per_s\": " << (wallTime_s > 0. ? double(nProcessedItems) / wallTime_s : 0.) << "," << std::endl
+		<< "  \"nProcessedItems\": " << nProcessedItems << "," << std::endl
+		<< "  \"nUnprocessedItems\": " << nUnprocessedItems << "," << std::endl
+		<< "  \"serializedItemSize_bytes\": " << serializedItemSize << "," << std::endl
+		<< "  \"loopbackBytesOnWire\": " << bytesOnWire << "," << std::endl
+		<< "  \"roundTrip_p50_ms\": " << percentile(lc.roundTrip_ms, 0.50) << "," << std::endl
+		<< "  \"roundTrip_p99_ms\": " << percentile(lc.roundTrip_ms, 0.99) << "," << std::endl
+		<< "  \"queueWait_p50_ms\": " << percentile(lc.queueWait_ms, 0.50) << "," << std::endl
+		<< "  \"queueWait_p99_ms\": " << percentile(lc.queueWait_ms, 0.99) << "," << std::endl
+		<< "  \"overhead_p50_ms\": " << percentile(lc.overhead_ms, 0.50) << "," << std::endl
+		<< "  \"overhead_p99_ms\": " << percentile(lc.overhead_ms, 0.99) << std::endl
+		<< "}" << std::endl;
+}
+
+/******************************************************************************/
+/**
+ * The main function
+ */
+int main(int argc, char **argv) {
+	//---------------------------------------------------------------------------
+	// We want to add additional command line options
+
+	std::uint32_t nGenerations = DEFAULTNGENERATIONS;
+	std::size_t populationSize = DEFAULTBENCHPOPULATIONSIZE;
+	std::size_t nVariables = DEFAULTNVARIABLES;
+	std::string evalDistribution = DEFAULTEVALDISTRIBUTION;
+	double evalTime = DEFAULTEVALTIME;
+	double evalSpread = DEFAULTEVALSPREAD;
+	double waitFactor = DEFAULTWAITFACTOR;
+	std::string label = DEFAULTLABEL;
+	std::string jsonOutput = DEFAULTJSONOUTPUT;
+
+	// Assemble command line options
+	boost::program_options::options_description user_options;
+	user_options.add_options()
+		("nGenerations", po::value<std::uint32_t>(&nGenerations)->default_value(DEFAULTNGENERATIONS), "The number of generations to submit")
+		("populationSize", po::value<std::size_t>(&populationSize)->default_value(DEFAULTBENCHPOPULATIONSIZE), "The number of work items per generation")
+		("nVariables", po::value<std::size_t>(&nVariables)->default_value(DEFAULTNVARIABLES), "The number of double values carried by each work item (the payload)")
+		("evalDistribution", po::value<std::string>(&evalDistribution)->default_value(DEFAULTEVALDISTRIBUTION), "The distribution of evaluation times: fixed, uniform, normal or exponential")
+		("evalTime", po::value<double>(&evalTime)->default_value(DEFAULTEVALTIME), "The mean evaluation time in seconds")
+		("evalSpread", po::value<double>(&evalSpread)->default_value(DEFAULTEVALSPREAD), "The half-width (uniform) or standard deviation (normal) of evaluation times in seconds")
+		("waitFactor", po::value<double>(&waitFactor)->default_value(DEFAULTWAITFACTOR), "The wait factor of the broker executor. 0 means: wait for the full return of all items")
+		("label", po::value<std::string>(&label)->default_value(DEFAULTLABEL), "A label identifying this run in the output. Defaults to the consumer name")
+		("jsonOutput", po::value<std::string>(&jsonOutput)->default_value(DEFAULTJSONOUTPUT), "The name of the file to which JSON results should be written");
+
+	Go2 go(argc, argv, "./config/Go2.json", user_options);
+
+	//---------------------------------------------------------------------------
+	// Client mode
+	if(go.clientMode()) {
+		return go.clientRun();
+	} // Execution will end here in client mode
+
+	//---------------------------------------------------------------------------
+	// Server mode
+
+	if(label.empty()) label = go.getConsumerName();
+	eval_time_distribution evalTimes(evalDistribution, evalTime, evalSpread);
+
+	// Set up the template from which all work items are cloned
+	std::shared_ptr<GDelayIndividual> template_ptr(new GDelayIndividual());
+	template_ptr->push_back(std::shared_ptr<GDoubleCollection>(new GDoubleCollection(nVariables, 0., 1.)));
+
+	std::size_t serializedItemSize = Gem::Common::sharedPtrToString(
+		std::shared_ptr<GParameterSet>(template_ptr)
+		, GCONSUMERSERIALIZATIONMODE
+	).size();
+
+	// Connect to the broker
+	GBrokerExecutorT<GParameterSet> executor;
+	executor.setWaitFactor(waitFactor);
+	executor.init();
+
+	latency_collector lc;
+	std::size_t nProcessedItems = 0, nUnprocessedItems = 0;
+	std::vector<std::shared_ptr<GParameterSet>> workItems;
+
+	std::uint64_t startBytes = loopback_tx_bytes();
+	bench_clock::time_point start = bench_clock::now();
+
+	for(std::uint32_t gen=0; gen<nGenerations; gen++) {
+		bench_clock::time_point gen_start = bench_clock::now();
+
+		// Set up the work items for this generation
+		workItems.clear();
+		for(std::size_t i=0; i<populationSize; i++) {
+			std::shared_ptr<GDelayIndividual> p = template_ptr->clone<GDelayIndividual>();
+			p->setFixedSleepTime(std::chrono::duration<double>(evalTimes()));
+			p->mark_as_due_for_processing();
+			workItems.push_back(p);
+		}
+
+		// Submit them through the broker
+		executor.workOn(workItems, false /* do not resubmit unprocessed items */);
+
+		// Collect latency information for current and late items
+		std::size_t nProcessedGen = 0;
+		for(auto const& p: workItems) {
+			if(p->is_processed()) {
+				lc.add(p);
+				nProcessedGen++;
+			} else {
+				nUnprocessedItems++;
+			}
+		}
+
+		for(auto const& p: executor.getOldWorkItems()) {
+			if(p->is_processed()) {
+				lc.add(p);
+				nProcessedGen++;
+			}
+		}
+
+		nProcessedItems += nProcessedGen;
+
+		std::cout
+			<< "Generation " << std::setw(5) << gen
+			<< ": " << std::setw(6) << nProcessedGen << " items processed in "
+			<< std::chrono::duration<double>(bench_clock::now() - gen_start).count() << " s"
+			<< std::endl;
+	}
+
+	bench_clock::time_point end = bench_clock::now();
+	std::uint64_t endBytes = loopback_tx_bytes();
+
+	executor.finalize();
+
+	//---------------------------------------------------------------------------
+	// Report the results
+
+	double wallTime_s = std::chrono::duration<double>(end - start).count();
+
+	std::cout
+		<< std::endl
+		<< "Consumer \"" << label << "\": "
+		<< (wallTime_s > 0. ? double(nGenerations) / wallTime_s : 0.) << " generations/s, "
+		<< (wallTime_s > 0. ? double(nProcessedItems) / wallTime_s : 0.) << " items/s, "
+		<< endBytes - startBytes << " bytes on loopback, "
+		<< nUnprocessedItems << " unprocessed items" << std::endl;
+
+	write_json_results(
+		jsonOutput
+		, label
+		, nGenerations
+		, populationSize
+		, nVariables
+		, evalDistribution
+		, evalTime
+		, evalSpread
+		, waitFactor
+		, wallTime_s
+		, nProcessedItems
+		, nUnprocessedItems
+		, serializedItemSize
+		, endBytes - startBytes
+		, lc
+	);
+
+	std::cout << "Results were written to " << jsonOutput << std::endl;
+
+	return 0;
+}
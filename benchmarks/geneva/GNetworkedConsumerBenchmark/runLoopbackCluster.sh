@@ -0,0 +1,131 @@
+#!/bin/bash
+
+################################################################################
+#
+# This file is part of the Geneva library collection. The following license
+# applies to this file:
+#
+# ------------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ------------------------------------------------------------------------------
+#
+# Note that other files in the Geneva library collection may use a different
+# license. Please see the licensing information in each file.
+#
+################################################################################
+#
+# Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+# with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+# information on Gemfony scientific, see http://www.gemfomy.eu .
+#
+# The majority of files in Geneva was released under the Apache license v2.0
+# in February 2020.
+#
+# See the NOTICE file in the top-level directory of the Geneva library
+# collection for a list of contributors and copyright information.
+#
+################################################################################
+# This script starts GNetworkedConsumerBenchmark in server mode plus a
+# given number of clients on the local host, once for each of the
+# networked consumers (asio, beast and -- if mpirun is available -- mpi).
+# All communication thus happens over the loopback interface. Each
+# server writes its results to ./output/<consumer>.json . Further
+# arguments are handed to the server, e.g. --nGenerations=50 or
+# --evalDistribution=exponential . Set the CONSUMERS environment
+# variable to restrict the run to a subset, e.g. CONSUMERS="asio".
+# Options for the clients may be passed through CLIENTOPTIONS.
+# Note that the MPI consumer usually communicates through shared
+# memory on a single host, so its loopback byte count may be 0.
+####################################################################
+
+if [ $# -lt 2 ]; then
+    echo "Usage: ./runLoopbackCluster.sh <number of clients> <port> [server options]"
+    exit 1
+fi
+
+PROGNAME=./GNetworkedConsumerBenchmark
+NCLIENTS=$1
+PORT=$2
+shift 2
+SERVEROPTIONS="$@"
+CONSUMERS=${CONSUMERS:-"asio beast mpi"}
+CLIENTOPTIONS=${CLIENTOPTIONS:-""}
+
+if [ ! -e ${PROGNAME} ]; then
+    echo "Error: Program file ${PROGNAME} does not exist."
+    exit 1
+fi
+
+if [ ! $(echo "${NCLIENTS}" | grep -E "^[0-9]+$") ]; then
+    echo "Error: Number of clients \"${NCLIENTS}\" is not a valid integer. Leaving."
+    exit 1
+fi
+if [ ! ${NCLIENTS} -gt 0 ];     then
+    echo "Error: \"${NCLIENTS}\" should at least be 1. Leaving"
+    exit 1
+fi
+
+if [ ! $(echo "${PORT}" | grep -E "^[0-9]+$") ]; then
+    echo "Error: Port \"${PORT}\" is not a valid integer. Leaving."
+    exit 1
+fi
+if [ ${PORT} -le 1000 ];     then
+    echo "Error: Port \"${PORT}\" should at least be 1001. Leaving"
+    exit 1
+fi
+
+if [ ! -d ./output ]; then
+    mkdir ./output
+fi
+
+for CONSUMER in ${CONSUMERS}; do
+    echo "Running consumer ${CONSUMER} with ${NCLIENTS} clients"
+
+    if [ "${CONSUMER}" = "mpi" ]; then
+        if ! command -v mpirun > /dev/null; then
+            echo "mpirun not found, skipping the mpi consumer"
+            continue
+        fi
+
+        # Rank 0 acts as the server, all other ranks are clients
+        mpirun -np $((NCLIENTS+1)) ${PROGNAME} --consumer mpi ${SERVEROPTIONS} --jsonOutput=./output/mpi.json >& ./output/output_mpi
+        continue
+    fi
+
+    # Start the server and give it some time to set up its listener
+    ${PROGNAME} --consumer ${CONSUMER} --${CONSUMER}_port=${PORT} ${SERVEROPTIONS} --jsonOutput=./output/${CONSUMER}.json >& ./output/output_${CONSUMER}_server &
+    SERVERPID=$!
+    sleep 2
+
+    CLIENTPIDS=""
+    for i in `seq 1 ${NCLIENTS}`; do
+        ${PROGNAME} --client --consumer ${CONSUMER} --${CONSUMER}_ip=localhost --${CONSUMER}_port=${PORT} ${CLIENTOPTIONS} >& ./output/output_${CONSUMER}_client_$i &
+        CLIENTPIDS="${CLIENTPIDS} $!"
+    done
+
+    # Clients may try to reconnect for a while after the server has left
+    wait ${SERVERPID}
+    kill ${CLIENTPIDS} >& /dev/null
+    wait ${CLIENTPIDS} >& /dev/null
+
+    # Use a fresh port for the next consumer, as the old one may still be in TIME_WAIT
+    PORT=$((PORT+1))
+done
+
+echo "Results:"
+for CONSUMER in ${CONSUMERS}; do
+    if [ -e ./output/${CONSUMER}.json ]; then
+        echo "--- ${CONSUMER}"
+        cat ./output/${CONSUMER}.json
+    fi
+done
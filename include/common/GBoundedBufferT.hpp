@@ -60,6 +60,7 @@
 #include <iostream>
 #include <fstream>
 #include <deque>
+#include <vector>
 #include <list>
 #include <algorithm>
 #include <stdexcept>
@@ -68,6 +69,7 @@
 #include <condition_variable>
 #include <chrono>
 #include <type_traits>
+#include <atomic>
 
 // Boost headers go here
 
@@ -78,6 +80,7 @@
 #include "common/GExceptions.hpp"
 #include "common/GPlotDesigner.hpp"
 #include "common/GLogger.hpp"
+#include "common/GErrorStreamer.hpp"
 #include "common/GCommonEnums.hpp"
 
 namespace Gem {
@@ -99,7 +102,9 @@ namespace Common {
  * this class assumes that an operator= is available for the items
  * stored in the buffer. Setting the template argument t_capacity to 0
  * results in an unbounded buffer, possibly useful for returning items,
- * if there may never be an "inflation".
+ * if there may never be an "inflation". For bounded buffers, t_capacity
+ * only serves as the default capacity. It may be changed at run-time, either
+ * upon construction or through setCapacity().
  *
  * Modify the behaviour of this class using the following defines:
  * - DEFAULTBUFFERSIZE: The maximum size of the buffer. "0" means "unlimited"
@@ -116,6 +121,21 @@ public:
 
 	 GBoundedBufferT() = default;
 
+	 /***************************************************************************/
+	 /**
+	  * Initialization with a run-time capacity. This is only possible for bounded
+	  * buffers, as the decision whether a buffer is unbounded is taken at compile-time.
+	  *
+	  * @param capacity The maximum number of items that may be stored in the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 explicit GBoundedBufferT(
+		 std::size_t capacity
+		 , std::enable_if_t<(u_capacity > 0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 this->setCapacity(capacity);
+	 }
+
 	 // Prevent assignment
 	 GBoundedBufferT(GBoundedBufferT<T, t_capacity> const &) = delete; ///< Disabled copy constructor
 	 GBoundedBufferT &operator=(GBoundedBufferT<T, t_capacity> const &) = delete; ///< Disabled assign operator
@@ -205,7 +225,7 @@ public:
 
 			 // Check if the size fits our requirements. Return
 			 // if this is note the case.
-			 if (m_container.size() >= u_capacity) {
+			 if (m_container.size() >= m_capacity) {
 				 return false;
 			 }
 
@@ -265,7 +285,7 @@ public:
 
 			 // Check if the size fits our requirements. Return
 			 // if this is note the case.
-			 if (m_container.size() >= u_capacity) {
+			 if (m_container.size() >= m_capacity) {
 				 return false;
 			 }
 
@@ -320,7 +340,7 @@ public:
 			 // deal with spurious wakeups
 			 m_not_full.wait(
 				 lock
-				 , [&]() -> bool { return m_container.size() < u_capacity; }
+				 , [&]() -> bool { return m_container.size() < m_capacity; }
 			 );
 			 m_container.push_front(item);
 		 } // Release the lock
@@ -370,7 +390,7 @@ public:
 			 // deal with spurious wakeups
 			 m_not_full.wait(
 				 lock
-				 , [&]() -> bool { return m_container.size() < u_capacity; }
+				 , [&]() -> bool { return m_container.size() < m_capacity; }
 			 );
 			 m_container.emplace_front(std::move(item));
 		 } // Release the lock
@@ -430,7 +450,7 @@ public:
 			 if (not m_not_full.wait_for(
 				 lock
 				 , std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
-				 , [&]() -> bool { return m_container.size() < u_capacity; }
+				 , [&]() -> bool { return m_container.size() < m_capacity; }
 			 )) {
 				 return false;
 			 }
@@ -493,7 +513,7 @@ public:
 			 if (not m_not_full.wait_for(
 				 lock
 				 , std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
-				 , [&]() -> bool { return m_container.size() < u_capacity; }
+				 , [&]() -> bool { return m_container.size() < m_capacity; }
 			 )) {
 				 return false;
 			 }
@@ -527,7 +547,7 @@ public:
 			 }
 		 } // Release the lock
 
-		 if(success) m_not_empty.notify_one();
+		 if(success) this->notify_removal(1);
 
 		 return success;
 	 }
@@ -554,7 +574,7 @@ public:
 			 }
 		 } // Release the lock
 
-		 if(success) m_not_empty.notify_one();
+		 if(success) this->notify_removal(1);
 
 		 return success;
 	 }
@@ -580,7 +600,7 @@ public:
 			 m_container.pop_back();
 		 } // Release the lock
 
-		 m_not_full.notify_one();
+		 this->notify_removal(1);
 	 }
 
 	 /***************************************************************************/
@@ -604,7 +624,7 @@ public:
 			 m_container.pop_back();
 		 } // Release the lock
 
-		 m_not_full.notify_one();
+		 this->notify_removal(1);
 	 }
 
 	 /***************************************************************************/
@@ -637,7 +657,7 @@ public:
 			 m_container.pop_back(); // Remove it from the container
 		 } // Release the lock
 
-		 m_not_full.notify_one();
+		 this->notify_removal(1);
 
 		 return true;
 	 }
@@ -672,22 +692,296 @@ public:
 			 m_container.pop_back(); // Remove it from the container
 		 } // Release the lock
 
-		 m_not_full.notify_one();
+		 this->notify_removal(1);
 
 		 return true;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Adds a number of items to an unbounded buffer in a single locked operation.
+	  * As there is no upper limit, all items will be added and the timeout is
+	  * ignored. This function will copy the items.
+	  *
+	  * @param items The items to be added to the buffer
+	  * @param timeout duration until a timeout occurs (unused for unbounded buffers)
+	  * @return The number of items that were added to the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 std::size_t
+	 push_and_wait_n_copy(
+		 std::vector<T> const& items
+		 , std::chrono::duration<double> const & timeout
+		 , std::enable_if_t<(u_capacity==0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 if(items.empty()) return 0;
+
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 for(auto const& item: items) {
+				 m_container.push_front(item);
+			 }
+		 } // Release the lock
+
+		 m_not_empty.notify_all();
+
+		 return items.size();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Adds a number of items to a bounded buffer. Items are added in as few locked
+	  * operations as the remaining space permits. If the buffer is full, the function
+	  * waits for free space, but will give up once the timeout has been reached. The
+	  * number of items actually added is returned; items are added in the order in
+	  * which they appear in the vector. This function will copy the items.
+	  *
+	  * @param items The items to be added to the buffer
+	  * @param timeout duration until a timeout occurs
+	  * @return The number of items that were added to the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 std::size_t
+	 push_and_wait_n_copy(
+		 std::vector<T> const& items
+		 , std::chrono::duration<double> const & timeout
+		 , std::enable_if_t<(u_capacity > 0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 auto end_time
+			 = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::milliseconds>(timeout);
+
+		 std::size_t nSubmitted = 0;
+		 while(nSubmitted < items.size()) {
+			 {
+				 std::unique_lock<std::mutex> lock(m_mutex);
+				 if (not m_not_full.wait_until(
+					 lock
+					 , end_time
+					 , [&]() -> bool { return m_container.size() < m_capacity; }
+				 )) {
+					 break;
+				 }
+
+				 while(nSubmitted < items.size() && m_container.size() < m_capacity) {
+					 m_container.push_front(items[nSubmitted++]);
+				 }
+			 } // Release the lock
+
+			 m_not_empty.notify_all();
+		 }
+
+		 return nSubmitted;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves up to nMax items from the buffer in a single locked operation
+	  * and appends them to a vector. The function waits at most for the given
+	  * amount of time for the first item to become available. It then takes
+	  * whatever is present (up to nMax items) without waiting any further.
+	  * Items are moved out of the buffer in the order in which they were added.
+	  *
+	  * @param items A vector to which the retrieved items are appended
+	  * @param nMax The maximum number of items to be retrieved
+	  * @param timeout duration until a timeout occurs
+	  * @return The number of items that were retrieved
+	  */
+	 std::size_t
+	 pop_and_wait_n_move(
+		 std::vector<T> &items
+		 , std::size_t nMax
+		 , std::chrono::duration<double> const & timeout
+	 ) {
+		 if(0 == nMax) return 0;
+
+		 std::size_t nRetrieved = 0;
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 if (not m_not_empty.wait_for(
+				 lock
+				 , std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
+				 , [&]() -> bool { return not m_container.empty(); }
+			 )) {
+				 return 0;
+			 }
+
+			 while(nRetrieved < nMax && not m_container.empty()) {
+				 items.push_back(std::move(m_container.back()));
+				 m_container.pop_back();
+				 nRetrieved++;
+			 }
+		 } // Release the lock
+
+		 this->notify_removal(nRetrieved);
+
+		 return nRetrieved;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves up to nMax items from the buffer in a single locked operation
+	  * and appends them to a vector. The function returns immediately, if no
+	  * items are available. Items are moved out of the buffer in the order in
+	  * which they were added.
+	  *
+	  * @param items A vector to which the retrieved items are appended
+	  * @param nMax The maximum number of items to be retrieved
+	  * @return The number of items that were retrieved
+	  */
+	 std::size_t
+	 try_pop_n_move(
+		 std::vector<T> &items
+		 , std::size_t nMax
+	 ) {
+		 if(0 == nMax) return 0;
+
+		 std::size_t nRetrieved = 0;
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 while(nRetrieved < nMax && not m_container.empty()) {
+				 items.push_back(std::move(m_container.back()));
+				 m_container.pop_back();
+				 nRetrieved++;
+			 }
+		 } // Release the lock
+
+		 if(nRetrieved > 0) this->notify_removal(nRetrieved);
+
+		 return nRetrieved;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Moves all items from the end of a vector into an unbounded buffer in a
+	  * single locked operation. The vector is left empty.
+	  *
+	  * @param items The items to be added to the buffer
+	  * @return The number of items that were added to the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 std::size_t
+	 try_push_n_move(
+		 std::vector<T> &items
+		 , std::enable_if_t<(u_capacity==0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 std::size_t nSubmitted = items.size();
+		 if(0 == nSubmitted) return 0;
+
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 while(not items.empty()) {
+				 m_container.emplace_front(std::move(items.back()));
+				 items.pop_back();
+			 }
+		 } // Release the lock
+
+		 m_not_empty.notify_all();
+
+		 return nSubmitted;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Moves items from the end of a vector into a bounded buffer in a single
+	  * locked operation, as far as the remaining space permits. The function
+	  * never waits. Items that were added are removed from the vector, the
+	  * others remain there.
+	  *
+	  * @param items The items to be added to the buffer
+	  * @return The number of items that were added to the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 std::size_t
+	 try_push_n_move(
+		 std::vector<T> &items
+		 , std::enable_if_t<(u_capacity > 0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 std::size_t nSubmitted = 0;
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 while(not items.empty() && m_container.size() < m_capacity) {
+				 m_container.emplace_front(std::move(items.back()));
+				 items.pop_back();
+				 nSubmitted++;
+			 }
+		 } // Release the lock
+
+		 if(nSubmitted > 0) m_not_empty.notify_all();
+
+		 return nSubmitted;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Waits until the buffer holds at most n items, e.g. so a producer may
+	  * pause submission until consumers have drained the buffer to a given
+	  * level. The function will return false if this was not achieved
+	  * within the given amount of time.
+	  *
+	  * @param n The maximum number of items that may remain in the buffer
+	  * @param timeout duration until a timeout occurs
+	  * @return A boolean indicating whether the buffer holds at most n items
+	  */
+	 bool
+	 wait_for_size_at_most(
+		 std::size_t n
+		 , std::chrono::duration<double> const & timeout
+	 ) {
+		 std::unique_lock<std::mutex> lock(m_mutex);
+
+		 m_n_drain_waiters++;
+		 bool success = m_drained.wait_for(
+			 lock
+			 , std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
+			 , [&]() -> bool { return m_container.size() <= n; }
+		 );
+		 m_n_drain_waiters--;
+
+		 return success;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Retrieves the maximum allowed size of the buffer. No need for
-	  * synchronization, as reading the value should be an atomic
-	  * operation.
+	  * synchronization, as reading the value is an atomic operation.
+	  * 0 means "unbounded".
 	  *
 	  * @return The maximum allowed capacity
 	  */
-	 constexpr std::size_t
-	 getCapacity() noexcept {
-		 return t_capacity;
+	 std::size_t
+	 getCapacity() const noexcept {
+		 return m_capacity;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Changes the capacity of a bounded buffer at run-time. If the capacity is
+	  * reduced below the current number of items, no items are removed. Instead,
+	  * submissions will be blocked until the buffer has drained sufficiently.
+	  *
+	  * @param capacity The new maximum number of items that may be stored in the buffer
+	  */
+	 template <std::size_t u_capacity = t_capacity>
+	 void
+	 setCapacity(
+		 std::size_t capacity
+		 , std::enable_if_t<(u_capacity > 0 && t_capacity==u_capacity)> * = nullptr
+	 ) {
+		 if(0 == capacity) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GBoundedBufferT<T, t_capacity>::setCapacity(): Error!" << std::endl
+					 << "A bounded buffer may not be given a capacity of 0" << std::endl
+			 );
+		 }
+
+		 {
+			 std::unique_lock<std::mutex> lock(m_mutex);
+			 m_capacity = capacity;
+		 } // Release the lock
+
+		 // There may be room for waiting producers now
+		 m_not_full.notify_all();
 	 }
 
 	 /***************************************************************************/
@@ -701,7 +995,7 @@ public:
 	 std::size_t
 	 getRemainingSpace() {
 		 std::unique_lock<std::mutex> lock(m_mutex);
-		 return t_capacity - m_container.size();
+		 return m_container.size() < m_capacity ? m_capacity - m_container.size() : 0;
 	 }
 
 	 /***************************************************************************/
@@ -756,10 +1050,31 @@ public:
 protected:
 	 /***************************************************************************/
 
+	 /***************************************************************************/
+	 /**
+	  * Wakes up producers after n items have been removed from the buffer,
+	  * as well as callers of wait_for_size_at_most(), if any.
+	  */
+	 void
+	 notify_removal(std::size_t n) {
+		 if(n > 1) {
+			 m_not_full.notify_all();
+		 } else {
+			 m_not_full.notify_one();
+		 }
+
+		 if(m_n_drain_waiters > 0) m_drained.notify_all();
+	 }
+
+	 /***************************************************************************/
+
 	 container_type m_container; ///< The actual data store
+	 std::atomic<std::size_t> m_capacity{t_capacity}; ///< The maximum number of items in the buffer; 0 means "unbounded"
 	 mutable std::mutex m_mutex{}; ///< Used for synchronization of access to the container
 	 std::condition_variable m_not_empty{}; ///< Used for synchronization of access to the container
 	 std::condition_variable m_not_full{}; ///< Used for synchronization of access to the container
+	 std::condition_variable m_drained{}; ///< Signals that items were removed to callers of wait_for_size_at_most()
+	 std::atomic<std::size_t> m_n_drain_waiters{0}; ///< The number of callers currently waiting in wait_for_size_at_most()
 };
 
 /******************************************************************************/
@@ -56,6 +56,8 @@
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
+#include <cstdint>
+#include <bitset>
 
 // Boost headers go here
 #include <boost/algorithm/string.hpp>
@@ -175,6 +177,20 @@ std::chrono::high_resolution_clock::time_point milliseconds_to_time_point(std::c
 G_API_COMMON
 void condnotset(std::string const&, std::string const&);
 
+/******************************************************************************/
+/** @brief The number of bits held in a single word of a packed bit vector */
+const std::size_t GBITSPERWORD = 64;
+
+/******************************************************************************/
+/** @brief Packs a std::vector<bool> into 64-bit words, least significant bit first */
+G_API_COMMON
+void packBits(std::vector<bool> const&, std::vector<std::uint64_t>&);
+
+/******************************************************************************/
+/** @brief Unpacks a given number of bits from 64-bit words into a std::vector<bool> */
+G_API_COMMON
+void unpackBits(std::vector<std::uint64_t> const&, std::size_t, std::vector<bool>&);
+
 /******************************************************************************/
 
 } /* namespace Common */
@@ -54,6 +54,9 @@
 #include <map>
 #include <cmath>
 #include <type_traits>
+#include <vector>
+#include <tuple>
+#include <algorithm>
 
 // Boost headers go here
 
@@ -71,6 +74,7 @@
 #include <boost/spirit/include/phoenix_bind.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/xpressive/xpressive.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/utility.hpp>
 #include <boost/fusion/include/adapt_struct.hpp>
 #include <boost/fusion/adapted/std_tuple.hpp> // Compare http://stackoverflow.com/questions/18158376/getting-boostspiritqi-to-use-stl-containers
@@ -286,12 +290,24 @@ struct signed_;
 struct unary_function_;
 struct binary_function_;
 struct ast_expression;
+struct variable_;
+
+/**
+ * Refers to a variable place holder of a formula, such as {{var1}}. Values are
+ * looked up through the slot number when the compiled formula is executed.
+ */
+struct variable_ {
+	std::size_t slot_ = 0;
+
+	void swap(variable_ &);
+};
 
 using operand =
 boost::variant<
 	nil
 	, float
 	, double
+	, variable_
 	, boost::recursive_wrapper<signed_>
 	, boost::recursive_wrapper<unary_function_>
 	, boost::recursive_wrapper<binary_function_>
@@ -344,6 +360,12 @@ inline std::ostream &operator<<(std::ostream &out, nil) {
 	return out;
 }
 
+/** @brief print function for debugging */
+inline std::ostream &operator<<(std::ostream &out, variable_ const &v) {
+	out << "slot " << v.slot_;
+	return out;
+}
+
 } /* namespace Common */
 } /* namespace Gem */
 
@@ -392,6 +414,10 @@ namespace Common {
  * as "var2" only the first value of the std::vector is used -- a notation such as
  * "var3{2]" is also possible -- in this case the third value of the vector will be
  * used. An exception will be thrown, if the vector doesn't have enough entries.
+ * The formula is parsed and compiled only once, upon the first evaluation. Each
+ * distinct place holder is assigned a numbered slot (see getVariableSlots()), so
+ * that callers evaluating the formula many times may alternatively supply the
+ * values as a std::vector<fp_type> holding one entry per slot.
  * An object of this class may deal with a single formula only, which is
  * given to it through the constructor. When a formula cannot be parsed,
  * an exception will be thrown. Likewise, exceptions derived from "Gem::Common::math_logic_error"
@@ -443,12 +469,14 @@ public:
 		op_min = 25,     // Calculates the min value of the two top-most stack-entries
 		op_max = 26,     // Calculates the max value of the two top-most stack-entries
 		op_fp = 27,     // Pushes a fp_type onto the stack
+		op_var = 28,     // Pushes the value of a variable slot onto the stack
 	};
 
 	using result_type = void; // Needed for the operator() and apply_visitor
-	using codeEntry = boost::variant<byte_code, fp_type>;
+	using codeEntry = boost::variant<byte_code, fp_type, std::size_t>;
 	using parameter_map = std::map<std::string, std::vector<fp_type>>;
 	using constants_map = std::map<std::string, fp_type>;
+	using slot_description = std::tuple<std::string, std::size_t>; // The name and index of a variable
 
 	/***************************************************************************/
 	/** @brief The default constructor -- intentionally deleted */
@@ -466,6 +494,7 @@ public:
 		, raw_formula_(formula)
 		, stack_(4096)
 		, stack_ptr_(stack_.begin())
+		, compiled_(false)
 		, printCode_(false)
 	{
 		boost::spirit::qi::char_type char_;
@@ -486,6 +515,10 @@ public:
 			constants_.add(cit->first, cit->second);
 		}
 
+		//---------------------------------------------------------------------------
+		// Assign a slot to each distinct place holder
+		this->registerPlaceHolders();
+
 		//---------------------------------------------------------------------------
 		// Define the actual grammar
 		expression_rule_ =
@@ -525,6 +558,7 @@ public:
 			| (char_('+') > factor_rule_)
 			| unary_function_rule_
 			| binary_function_rule_
+			| variables_
 			| constants_;
 
 		//---------------------------------------------------------------------------
@@ -593,39 +627,62 @@ public:
 		return this->replacePlaceHolders(vm);
 	}
 
+	/***************************************************************************/
+	/**
+	 * Retrieves the variables used in the formula. The position of each entry
+	 * is the slot number expected by evaluate(const std::vector<fp_type>&).
+	 * A place holder without index, such as {{var1}}, refers to index 0.
+	 */
+	const std::vector<slot_description>& getVariableSlots() const {
+		return slots_;
+	}
+
 	/***************************************************************************/
 	/**
 	 * Evaluates a formula after replacing place holders with values
 	 */
 	fp_type evaluate(const parameter_map &vm = parameter_map()) const {
-		// Clear local data structures
-		code_.clear();
-		stack_ptr_ = stack_.begin();
+		slotValues_.resize(slots_.size());
 
-		ast_expression ast; ///< The abstract syntax tree
-
-		// Replace place holders with values taken from the map
-		std::string formula = this->replacePlaceHolders(vm);
+		std::size_t slot = 0;
+		for(const auto& slot_desc: slots_) {
+			auto cit = vm.find(std::get<0>(slot_desc));
+			if(cit == vm.end() || std::get<1>(slot_desc) >= (cit->second).size()) {
+				throw gemfony_exception(
+					g_error_streamer(DO_LOG, time_and_place)
+						<< "In GFormulaParserT<>::evaluate(): Error!" << std::endl
+						<< "No value found for place holder " << std::get<0>(slot_desc) << "[" << std::get<1>(slot_desc) << "]" << std::endl
+						<< "in formula " << raw_formula_ << std::endl
+				);
+			}
 
-		// Do the actual parsing of the formula
-		std::string::const_iterator iter = formula.begin();
-		std::string::const_iterator end = formula.end();
-		boost::spirit::ascii::space_type space;
-		bool r = boost::spirit::qi::phrase_parse(iter, end, *this, space, ast);
+			slotValues_[slot++] = (cit->second)[std::get<1>(slot_desc)];
+		}
 
-		if (r && iter == end) {
-			this->compile(ast);
-			this->execute();
-		} else {
-			std::string rest(iter, end);
+		return this->evaluate(slotValues_);
+	}
 
+	/***************************************************************************/
+	/**
+	 * Evaluates a formula with the values of all variables given in the order
+	 * of their slots (see getVariableSlots()). This avoids any string handling.
+	 */
+	fp_type evaluate(const std::vector<fp_type> &slotValues) const {
+		if(slotValues.size() < slots_.size()) {
 			throw gemfony_exception(
 				g_error_streamer(DO_LOG, time_and_place)
-					<< "In GFormulaParserT<>::evaluate(): Error!" << std::endl
-					<< "Parsing of formula " << formula << " failed at " << rest << std::endl
+					<< "In GFormulaParserT<>::evaluate(const std::vector<fp_type>&): Error!" << std::endl
+					<< "Got " << slotValues.size() << " values for " << slots_.size() << " slots" << std::endl
 			);
 		}
 
+		// Parse and compile the formula upon the first call
+		if(not compiled_) {
+			this->parseAndCompile();
+		}
+
+		this->execute(slotValues.data());
+
 		return stack_.at(0);
 	}
 
@@ -646,6 +703,11 @@ public:
 		code_.push_back(codeEntry(fp_val));
 	}
 
+	void operator()(const variable_ &v) const {
+		code_.push_back(codeEntry(byte_code::op_var));
+		code_.push_back(codeEntry(v.slot_));
+	}
+
 	void operator()(const operation &x) const {
 		boost::apply_visitor(*this, x.operand_);
 
@@ -754,6 +816,70 @@ private:
 		return formula;
 	}
 
+	/***************************************************************************/
+	/**
+	 * Assigns a slot to each distinct place holder found in the formula and
+	 * makes the place holders known to the grammar. {{var}} and {{var[0]}}
+	 * share the same slot.
+	 */
+	void registerPlaceHolders() {
+		boost::xpressive::sregex re = boost::xpressive::sregex::compile("\\{\\{([^\\[\\}]+)(\\[([0-9]+)\\])?\\}\\}");
+		boost::xpressive::sregex_iterator it(raw_formula_.begin(), raw_formula_.end(), re), end;
+
+		for(; it != end; ++it) {
+			const boost::xpressive::smatch &what = *it;
+			std::string place_holder = what[0];
+
+			// Place holders may appear more than once in the formula
+			if(variables_.find(place_holder)) continue;
+
+			slot_description slot_desc(
+				what[1]
+				, what[3].matched ? boost::lexical_cast<std::size_t>(what[3].str()) : std::size_t(0)
+			);
+
+			variable_ v;
+			auto slot_it = std::find(slots_.begin(), slots_.end(), slot_desc);
+			if(slot_it == slots_.end()) {
+				v.slot_ = slots_.size();
+				slots_.push_back(slot_desc);
+			} else {
+				v.slot_ = static_cast<std::size_t>(std::distance(slots_.begin(), slot_it));
+			}
+
+			variables_.add(place_holder, v);
+		}
+	}
+
+	/***************************************************************************/
+	/**
+	 * Parses the raw formula (including place holders) and compiles the AST into byte code
+	 */
+	void parseAndCompile() const {
+		code_.clear();
+
+		ast_expression ast; ///< The abstract syntax tree
+
+		// Do the actual parsing of the formula
+		std::string::const_iterator iter = raw_formula_.begin();
+		std::string::const_iterator end = raw_formula_.end();
+		boost::spirit::ascii::space_type space;
+		bool r = boost::spirit::qi::phrase_parse(iter, end, *this, space, ast);
+
+		if (r && iter == end) {
+			this->compile(ast);
+			compiled_ = true;
+		} else {
+			std::string rest(iter, end);
+
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GFormulaParserT<>::parseAndCompile(): Error!" << std::endl
+					<< "Parsing of formula " << raw_formula_ << " failed at " << rest << std::endl
+			);
+		}
+	}
+
 	/***************************************************************************/
 	/**
 	 * Compiles the AST into byte code
@@ -765,8 +891,10 @@ private:
 	/***************************************************************************/
 	/**
 	 * The actual calculations
+	 *
+	 * @param slotValues The values of all variable slots
 	 */
-	void execute() const {
+	void execute(const fp_type *slotValues) const {
 		// Position pointers for stack and code
 		typename std::vector<codeEntry>::const_iterator code_ptr = code_.begin();
 		stack_ptr_ = stack_.begin();
@@ -928,6 +1056,10 @@ private:
 					*stack_ptr_++ = boost::get<fp_type>(*code_ptr++);
 					break;
 
+				case byte_code::op_var:
+					*stack_ptr_++ = slotValues[boost::get<std::size_t>(*code_ptr++)];
+					break;
+
 				default: {
 					throw gemfony_exception(
 						g_error_streamer(DO_LOG, time_and_place)
@@ -992,12 +1124,18 @@ private:
 	boost::spirit::qi::real_parser<fp_type, boost::spirit::qi::real_policies<fp_type>> real;
 
 	boost::spirit::qi::symbols<std::iterator_traits<std::string::const_iterator>::value_type, fp_type> constants_; ///< Holds mathematical- and user-defined constants
+	boost::spirit::qi::symbols<std::iterator_traits<std::string::const_iterator>::value_type, variable_> variables_; ///< Maps place holders to their slots
+
+	std::vector<slot_description> slots_; ///< The name and index of the variable held in each slot
+	mutable std::vector<fp_type> slotValues_; ///< Holds the slot values when evaluating with a parameter_map
 
 	mutable std::vector<fp_type> stack_; ///< Holds the data needed as input for each operation
 	mutable std::vector<codeEntry> code_; ///< Holds the "compiled" code
 
 	mutable typename std::vector<fp_type>::iterator stack_ptr_;
 
+	mutable bool compiled_; ///< Indicates whether code_ holds the compiled formula
+
 	bool printCode_; ///< When set, the code will be printed prior to the evaluation
 };
 
@@ -1011,6 +1149,7 @@ namespace boost {
 namespace spirit {
 
 G_API_COMMON void swap(Gem::Common::nil &, Gem::Common::nil &);
+G_API_COMMON void swap(Gem::Common::variable_ &, Gem::Common::variable_ &);
 G_API_COMMON void swap(Gem::Common::signed_ &, Gem::Common::signed_ &);
 G_API_COMMON void swap(Gem::Common::operation &, Gem::Common::operation &);
 G_API_COMMON void swap(Gem::Common::unary_function_ &, Gem::Common::unary_function_ &);
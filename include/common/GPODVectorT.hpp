@@ -45,6 +45,7 @@
 #include <cmath>
 #include <algorithm>
 #include <type_traits>
+#include <cstdint>
 
 // Boost header files go here
 
@@ -65,10 +66,12 @@
 #include <boost/serialization/tracking.hpp>
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/version.hpp>
 
 // Geneva headers go here
 
 #include "common/GExceptions.hpp"
+#include "common/GCommonHelperFunctions.hpp"
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GLogger.hpp"
 #include "common/GErrorStreamer.hpp"
@@ -95,7 +98,7 @@ class GPODVectorT
     friend class boost::serialization::access;
 
     template<typename Archive>
-    void serialize(Archive &ar, const unsigned int) {
+    void serialize(Archive &ar, const unsigned int version) {
         using boost::serialization::make_nvp;
 
 #if BOOST_VERSION <= 105800
@@ -106,7 +109,30 @@ class GPODVectorT
 		}
 #endif
 
-        ar & BOOST_SERIALIZATION_NVP(m_data_cnt);
+        if constexpr(std::is_same<T, bool>::value) {
+            // Version 0 archives stored one entry per bit
+            if(version == 0) {
+                ar & BOOST_SERIALIZATION_NVP(m_data_cnt);
+                return;
+            }
+
+            // From version 1 on, bits are written as packed 64-bit words
+            std::size_t nBits = m_data_cnt.size();
+            std::vector<std::uint64_t> words;
+            if(not Archive::is_loading::value) {
+                Gem::Common::packBits(m_data_cnt, words);
+            }
+
+            ar
+            & make_nvp("nBits", nBits)
+            & make_nvp("words", words);
+
+            if(Archive::is_loading::value) {
+                Gem::Common::unpackBits(words, nBits, m_data_cnt);
+            }
+        } else {
+            ar & BOOST_SERIALIZATION_NVP(m_data_cnt);
+        }
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -503,3 +529,18 @@ struct is_abstract<const Gem::Common::GPODVectorT<T>> :
 } /* namespace boost */
 
 /******************************************************************************/
+// The version of GPODVectorT<>. This is the content of BOOST_CLASS_VERSION(T, 1)
+// for bool collections, which are stored as packed words from version 1 on
+
+namespace boost {
+namespace serialization {
+template<typename T>
+struct version<Gem::Common::GPODVectorT<T>> {
+	typedef mpl::int_<std::is_same<T, bool>::value ? 1 : 0> type;
+	typedef mpl::integral_c_tag tag;
+	BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+} /* namespace serialization */
+} /* namespace boost */
+
+/******************************************************************************/
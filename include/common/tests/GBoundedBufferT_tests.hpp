@@ -7,6 +7,7 @@
 // Standard headers go here
 #include <vector>
 #include <algorithm>
+#include <filesystem>
 
 // Boost headers go here
 #include <boost/test/unit_test.hpp>
@@ -826,6 +827,152 @@ public:
 		 }
 
 		 //----------------------------------------------------------------------
+
+		 { // Check submission and retrieval of several items in one go
+			 std::chrono::milliseconds timeout(1);
+
+			 //------------------------------------------
+			 // An unbounded queue accepts all items
+
+			 GBoundedBufferT<copy_only_struct, 0> gbt_unbounded;
+			 std::vector<copy_only_struct> items;
+			 for (std::size_t i = 0; i < 2*DEFAULTBUFFERSIZE; i++) {
+				 copy_only_struct c(i);
+				 items.push_back(c);
+			 }
+
+			 std::size_t nSubmitted = 0;
+			 BOOST_CHECK_NO_THROW(nSubmitted = gbt_unbounded.push_and_wait_n_copy(items, timeout));
+			 BOOST_CHECK(nSubmitted == 2*DEFAULTBUFFERSIZE);
+			 BOOST_CHECK(gbt_unbounded.size() == 2*DEFAULTBUFFERSIZE);
+
+			 //------------------------------------------
+			 // A bounded queue accepts items until it is full
+
+			 GBoundedBufferT<move_only_struct> gbt_bounded; // DEFAULTBUFFERSIZE
+			 std::vector<move_only_struct> mo_items;
+			 for (std::size_t i = 0; i < DEFAULTBUFFERSIZE; i++) {
+				 BOOST_CHECK(gbt_bounded.try_push_move(move_only_struct(i)));
+			 }
+			 BOOST_CHECK(gbt_bounded.size() == DEFAULTBUFFERSIZE);
+
+			 //------------------------------------------
+			 // Retrieval in chunks preserves the order of submission
+
+			 std::size_t nRetrieved = 0;
+			 std::size_t chunkSize = 7;
+			 std::size_t expected_secret = 0;
+			 while(expected_secret < DEFAULTBUFFERSIZE) {
+				 mo_items.clear();
+				 BOOST_CHECK_NO_THROW(nRetrieved = gbt_bounded.pop_and_wait_n_move(mo_items, chunkSize, timeout));
+				 BOOST_CHECK(nRetrieved == (std::min)(chunkSize, DEFAULTBUFFERSIZE - expected_secret));
+				 BOOST_CHECK(nRetrieved == mo_items.size());
+				 for(auto const& m: mo_items) {
+					 BOOST_CHECK(m.getSecret() == expected_secret++);
+				 }
+			 }
+			 BOOST_CHECK(gbt_bounded.empty());
+
+			 // Retrieval from an empty queue times out
+			 mo_items.clear();
+			 BOOST_CHECK_NO_THROW(nRetrieved = gbt_bounded.pop_and_wait_n_move(mo_items, chunkSize, timeout));
+			 BOOST_CHECK(0 == nRetrieved);
+			 BOOST_CHECK(mo_items.empty());
+
+			 //------------------------------------------
+			 // Bulk submission to a bounded queue stops at its capacity
+
+			 GBoundedBufferT<copy_only_struct> gbt_co_bounded; // DEFAULTBUFFERSIZE
+			 BOOST_CHECK_NO_THROW(nSubmitted = gbt_co_bounded.push_and_wait_n_copy(items, timeout));
+			 BOOST_CHECK(nSubmitted == DEFAULTBUFFERSIZE);
+			 BOOST_CHECK(gbt_co_bounded.size() == DEFAULTBUFFERSIZE);
+
+			 //------------------------------------------
+			 // Non-blocking bulk exchange with a bounded queue
+
+			 GBoundedBufferT<move_only_struct> gbt_small(10);
+			 mo_items.clear();
+			 for (std::size_t i = 0; i < 15; i++) {
+				 mo_items.push_back(move_only_struct(i));
+			 }
+
+			 // Items are taken from the end of the vector until the queue is full
+			 BOOST_CHECK_NO_THROW(nSubmitted = gbt_small.try_push_n_move(mo_items));
+			 BOOST_CHECK(nSubmitted == 10);
+			 BOOST_CHECK(gbt_small.size() == 10);
+			 BOOST_CHECK(mo_items.size() == 5);
+			 BOOST_CHECK(mo_items.back().getSecret() == 4);
+
+			 // Nothing fits into a full queue
+			 BOOST_CHECK_NO_THROW(nSubmitted = gbt_small.try_push_n_move(mo_items));
+			 BOOST_CHECK(0 == nSubmitted);
+			 BOOST_CHECK(mo_items.size() == 5);
+
+			 mo_items.clear();
+			 BOOST_CHECK_NO_THROW(nRetrieved = gbt_small.try_pop_n_move(mo_items, 4));
+			 BOOST_CHECK(4 == nRetrieved);
+			 BOOST_CHECK(mo_items.front().getSecret() == 14);
+			 BOOST_CHECK_NO_THROW(nRetrieved = gbt_small.try_pop_n_move(mo_items, 100));
+			 BOOST_CHECK(6 == nRetrieved);
+			 BOOST_CHECK(mo_items.back().getSecret() == 5);
+			 BOOST_CHECK_NO_THROW(nRetrieved = gbt_small.try_pop_n_move(mo_items, 100));
+			 BOOST_CHECK(0 == nRetrieved);
+			 BOOST_CHECK(gbt_small.empty());
+
+			 //------------------------------------------
+			 // An unbounded queue takes all items in one go
+
+			 GBoundedBufferT<move_only_struct, 0> gbt_mo_unbounded;
+			 BOOST_CHECK_NO_THROW(nSubmitted = gbt_mo_unbounded.try_push_n_move(mo_items));
+			 BOOST_CHECK(nSubmitted == 10);
+			 BOOST_CHECK(mo_items.empty());
+			 BOOST_CHECK(gbt_mo_unbounded.size() == 10);
+
+			 //------------------------------------------
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check run-time capacities of bounded buffers
+			 std::chrono::milliseconds timeout(1);
+
+			 GBoundedBufferT<copy_only_struct> gbt(10); // DEFAULTBUFFERSIZE is only the default
+			 BOOST_CHECK(gbt.getCapacity() == 10);
+			 BOOST_CHECK(gbt.getRemainingSpace() == 10);
+
+			 for (std::size_t i = 0; i < 10; i++) {
+				 copy_only_struct c(i);
+				 BOOST_CHECK(gbt.try_push_copy(c));
+			 }
+			 copy_only_struct c_extra(10);
+			 BOOST_CHECK(!gbt.try_push_copy(c_extra)); // The buffer is full
+			 BOOST_CHECK(gbt.getRemainingSpace() == 0);
+
+			 // Reducing the capacity below the fill level does not remove items
+			 BOOST_CHECK_NO_THROW(gbt.setCapacity(5));
+			 BOOST_CHECK(gbt.getCapacity() == 5);
+			 BOOST_CHECK(gbt.size() == 10);
+			 BOOST_CHECK(gbt.getRemainingSpace() == 0);
+
+			 // The buffer does not yet hold at most 5 items
+			 BOOST_CHECK(!gbt.wait_for_size_at_most(5, timeout));
+
+			 // Drain the buffer
+			 for (std::size_t i = 0; i < 5; i++) {
+				 copy_only_struct c(100);
+				 BOOST_CHECK(gbt.try_pop_copy(c));
+				 BOOST_CHECK(c.getSecret() == i);
+			 }
+			 BOOST_CHECK(gbt.wait_for_size_at_most(5, timeout));
+			 BOOST_CHECK(!gbt.try_push_copy(c_extra)); // Still full with the reduced capacity
+
+			 // Increasing the capacity makes room again
+			 BOOST_CHECK_NO_THROW(gbt.setCapacity(20));
+			 BOOST_CHECK(gbt.getRemainingSpace() == 15);
+			 BOOST_CHECK(gbt.try_push_copy(c_extra));
+		 }
+
+		 //----------------------------------------------------------------------
 	 }
 
 	 /*************************************************************************/
@@ -833,7 +980,18 @@ public:
 	  * Test features that are expected to fail
 	  */
 	 void failures_expected() {
-		 { /* nothing */ }
+		 { // A bounded buffer may not be given a capacity of 0
+			 // The exceptions are logged to a file, which we remove again if it did not exist before
+			 std::filesystem::path exception_log("./GENEVA-EXCEPTION.log");
+			 bool log_existed = std::filesystem::exists(exception_log);
+
+			 BOOST_CHECK_THROW((GBoundedBufferT<copy_only_struct>(0)), gemfony_exception);
+
+			 GBoundedBufferT<copy_only_struct> gbt;
+			 BOOST_CHECK_THROW(gbt.setCapacity(0), gemfony_exception);
+
+			 if(not log_existed) std::filesystem::remove(exception_log);
+		 }
 	 }
 };
 
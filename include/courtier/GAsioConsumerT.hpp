@@ -49,6 +49,7 @@
 #include <mutex>
 #include <thread>
 #include <array>
+#include <type_traits>
 
 // Boost headers go here
 #include <boost/asio.hpp>
@@ -81,6 +82,164 @@
 namespace Gem {
 namespace Courtier {
 
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * A fixed block of memory that may be reused for the completion handlers of a
+ * strictly sequential chain of asynchronous operations (such as the read- and
+ * write-cycles of GAsioConsumerSessionT and GAsioConsumerClientT). Only one
+ * handler may occupy the block at any given time. Requests that do not fit,
+ * that arrive while the block is in use or that are made while recycling has
+ * been switched off are served by the global operator new.
+ */
+class GAsioHandlerMemory {
+public:
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Initialization with a flag indicating whether memory should be recycled
+	  */
+	 explicit GAsioHandlerMemory(bool recycle)
+		 : m_recycle(recycle)
+	 { /* nothing */ }
+
+	 //-------------------------------------------------------------------------
+	 // Deleted functions -- the memory block is tied to its owner
+
+	 GAsioHandlerMemory() = delete;
+	 GAsioHandlerMemory(const GAsioHandlerMemory&) = delete;
+	 GAsioHandlerMemory(GAsioHandlerMemory&&) = delete;
+	 GAsioHandlerMemory& operator=(const GAsioHandlerMemory&) = delete;
+	 GAsioHandlerMemory& operator=(GAsioHandlerMemory&&) = delete;
+
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Hands out the internal block if possible, otherwise falls back to ::operator new
+	  */
+	 void *allocate(std::size_t size) {
+		 if(m_recycle && not m_in_use && size <= sizeof(m_storage)) {
+			 m_in_use = true;
+			 return &m_storage;
+		 }
+
+		 return ::operator new(size);
+	 }
+
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Returns memory obtained through allocate()
+	  */
+	 void deallocate(void *pointer) noexcept {
+		 if(pointer == &m_storage) {
+			 m_in_use = false;
+		 } else {
+			 ::operator delete(pointer);
+		 }
+	 }
+
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Allows to check whether memory is being recycled
+	  */
+	 bool recycles() const noexcept {
+		 return m_recycle;
+	 }
+
+private:
+	 //-------------------------------------------------------------------------
+	 // Data
+
+	 typename std::aligned_storage<GASIOHANDLERMEMORYSIZE>::type m_storage; ///< The reusable memory block
+	 bool m_in_use = false; ///< Indicates whether m_storage is currently occupied by a handler
+	 bool m_recycle = GASIOCONSUMERRECYCLEHANDLERMEMORY; ///< When false, all requests are forwarded to ::operator new
+};
+
+/******************************************************************************/
+/**
+ * A minimal allocator drawing its memory from a GAsioHandlerMemory object.
+ * It is found by asio through the associated allocator of GAsioAllocHandlerT.
+ */
+template<typename T>
+class GAsioHandlerAllocatorT {
+	 template<typename> friend class GAsioHandlerAllocatorT;
+
+public:
+	 using value_type = T;
+
+	 explicit GAsioHandlerAllocatorT(GAsioHandlerMemory& mem) noexcept
+		 : m_memory(mem)
+	 { /* nothing */ }
+
+	 template<typename U>
+	 GAsioHandlerAllocatorT(const GAsioHandlerAllocatorT<U>& cp) noexcept // NOLINT
+		 : m_memory(cp.m_memory)
+	 { /* nothing */ }
+
+	 bool operator==(const GAsioHandlerAllocatorT& other) const noexcept {
+		 return &m_memory == &other.m_memory;
+	 }
+
+	 bool operator!=(const GAsioHandlerAllocatorT& other) const noexcept {
+		 return &m_memory != &other.m_memory;
+	 }
+
+	 T *allocate(std::size_t n) const {
+		 return static_cast<T *>(m_memory.allocate(sizeof(T) * n));
+	 }
+
+	 void deallocate(T *p, std::size_t /* n */) const noexcept {
+		 m_memory.deallocate(p);
+	 }
+
+private:
+	 GAsioHandlerMemory& m_memory;
+};
+
+/******************************************************************************/
+/**
+ * Wraps a completion handler so that asio allocates its intermediate storage
+ * through GAsioHandlerAllocatorT. The wrapper may be passed to bind_executor(),
+ * whose associated allocator forwards to the wrapped handler.
+ */
+template<typename handler_type>
+class GAsioAllocHandlerT {
+public:
+	 using allocator_type = GAsioHandlerAllocatorT<handler_type>;
+
+	 GAsioAllocHandlerT(GAsioHandlerMemory& mem, handler_type handler)
+		 : m_memory(mem)
+		 , m_handler(std::move(handler))
+	 { /* nothing */ }
+
+	 allocator_type get_allocator() const noexcept {
+		 return allocator_type(m_memory);
+	 }
+
+	 template<typename... Args>
+	 void operator()(Args&&... args) {
+		 m_handler(std::forward<Args>(args)...);
+	 }
+
+private:
+	 GAsioHandlerMemory& m_memory;
+	 handler_type m_handler;
+};
+
+/******************************************************************************/
+/**
+ * Convenience function for the creation of a GAsioAllocHandlerT object
+ */
+template<typename handler_type>
+GAsioAllocHandlerT<typename std::decay<handler_type>::type> make_asio_alloc_handler(
+	GAsioHandlerMemory& mem
+	, handler_type&& handler
+) {
+	return GAsioAllocHandlerT<typename std::decay<handler_type>::type>(
+		mem
+		, std::forward<handler_type>(handler)
+	);
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -110,11 +269,13 @@ public:
 		 , unsigned short port
 		 , Gem::Common::serializationMode serialization_mode
 		 , std::size_t max_reconnects
+		 , bool recycle_handler_memory = GASIOCONSUMERRECYCLEHANDLERMEMORY
 	 )
 		 : m_address(std::move(address))
 		 , m_port(port)
 		 , m_serialization_mode(serialization_mode)
 	 	 , m_max_reconnects(max_reconnects)
+		 , m_handler_memory(recycle_handler_memory)
 	 { /* nothing */ }
 
 	 //-------------------------------------------------------------------------
@@ -189,12 +350,15 @@ private:
 		 m_resolver.async_resolve(
 			 m_address
 			 , std::to_string(m_port)
-			 , [self](
-				 boost::system::error_code ec
-				 , const resolver::results_type &results
-			 ) {
-				 self->when_resolved(ec, results);
-			 }
+			 , make_asio_alloc_handler(
+				 m_handler_memory
+				 , [self](
+					 boost::system::error_code ec
+					 , const resolver::results_type &results
+				 ) {
+					 self->when_resolved(ec, results);
+				 }
+			 )
 		 );
 	 }
 
@@ -227,9 +391,12 @@ private:
 		 	 *m_socket_ptr
 			 , results.begin()
 			 , results.end()
-			 , [self](boost::system::error_code ec, boost::asio::ip::tcp::resolver::iterator /* unused */) {
-				 self->when_connected(ec);
-			 }
+			 , make_asio_alloc_handler(
+				 m_handler_memory
+				 , [self](boost::system::error_code ec, boost::asio::ip::tcp::resolver::iterator /* unused */) {
+					 self->when_connected(ec);
+				 }
+			 )
 		 );
 	 }
 
@@ -282,12 +449,15 @@ private:
 		 boost::asio::async_write(
 			 *m_socket_ptr
 			 , boost::asio::buffer(m_outgoing_message_str)
-			 , [self](
-				 boost::system::error_code ec
-				 , std::size_t nBytesTransferred
-			 ) {
-				 self->when_written(ec, nBytesTransferred);
-			 }
+			 , make_asio_alloc_handler(
+				 m_handler_memory
+				 , [self](
+					 boost::system::error_code ec
+					 , std::size_t nBytesTransferred
+				 ) {
+					 self->when_written(ec, nBytesTransferred);
+				 }
+			 )
 		 );
 	 }
 
@@ -326,12 +496,15 @@ private:
 		 boost::asio::async_read(
 			 *m_socket_ptr
 			 , boost::asio::dynamic_buffer(m_incoming_message_str)
-			 , [self] (
-				 boost::system::error_code ec
-				 , std::size_t nBytesTransferred
-			 ) {
-				 self->when_read(ec, nBytesTransferred);
-			 }
+			 , make_asio_alloc_handler(
+				 m_handler_memory
+				 , [self] (
+					 boost::system::error_code ec
+					 , std::size_t nBytesTransferred
+				 ) {
+					 self->when_read(ec, nBytesTransferred);
+				 }
+			 )
 		 );
 	 }
 
@@ -473,6 +646,8 @@ private:
 	 std::string m_incoming_message_str; ///< Receives incoming messages
 	 std::string m_outgoing_message_str; ///< Helps to persist outgoing messages
 
+	 GAsioHandlerMemory m_handler_memory{GASIOCONSUMERRECYCLEHANDLERMEMORY}; ///< Reused for the completion handlers of the send/receive chain
+
 	 std::random_device m_nondet_rng; ///< Source of non-deterministic random numbers
 	 std::mt19937 m_rng_engine{m_nondet_rng()}; ///< The actual random number engine, seeded my m_nondet_rng
 
@@ -500,6 +675,7 @@ public:
 	  * @param put_payload_item A callback used to submit a processed payload item to the server
 	  * @param check_server_stopped A callback used to check whether the server has been stopped
 	  * @param serialization_mode The serialization mode used for data transfers (binary, xml or plain text)
+	  * @param recycle_handler_memory Whether completion handlers should reuse a per-session memory block
 	  */
 	 GAsioConsumerSessionT(
          boost::asio::io_context& io_context
@@ -508,6 +684,7 @@ public:
 		 , std::function<void(std::shared_ptr<processable_type>)> put_payload_item
 		 , std::function<bool()> check_server_stopped
 		 , Gem::Common::serializationMode serialization_mode
+		 , bool recycle_handler_memory = GASIOCONSUMERRECYCLEHANDLERMEMORY
 	 )
 		 : m_socket(std::move(socket))
 		 , m_strand(io_context.get_executor())
@@ -515,6 +692,7 @@ public:
 		 , m_put_payload_item(std::move(put_payload_item))
 		 , m_check_server_stopped(std::move(check_server_stopped))
 		 , m_serialization_mode(serialization_mode)
+		 , m_handler_memory(recycle_handler_memory)
 	 { /* nothing */ }
 
 	 //-------------------------------------------------------------------------
@@ -550,12 +728,15 @@ private:
 			 , boost::asio::dynamic_buffer(m_incoming_message_str)
 			 , boost::asio::bind_executor(
 				 m_strand
-				 , [self] (
-					 boost::system::error_code ec
-					 , std::size_t nBytesTransferred
-				 ) {
-					 self->when_read(ec, nBytesTransferred);
-				 }
+				 , make_asio_alloc_handler(
+					 m_handler_memory
+					 , [self] (
+						 boost::system::error_code ec
+						 , std::size_t nBytesTransferred
+					 ) {
+						 self->when_read(ec, nBytesTransferred);
+					 }
+				 )
 			 )
 		 );
 	 }
@@ -609,12 +790,15 @@ private:
 			 , boost::asio::buffer(m_outgoing_message_str)
 			 , boost::asio::bind_executor(
 				 m_strand
-				 , [self](
-					 boost::system::error_code ec
-					 , std::size_t nBytesTransferred
-				 ) {
-					 self->when_written(ec, nBytesTransferred);
-				 }
+				 , make_asio_alloc_handler(
+					 m_handler_memory
+					 , [self](
+						 boost::system::error_code ec
+						 , std::size_t nBytesTransferred
+					 ) {
+						 self->when_written(ec, nBytesTransferred);
+					 }
+				 )
 			 )
 		 );
 	 }
@@ -745,6 +929,8 @@ private:
 
 	 Gem::Common::serializationMode m_serialization_mode = Gem::Common::serializationMode::BINARY;
 
+	 GAsioHandlerMemory m_handler_memory{GASIOCONSUMERRECYCLEHANDLERMEMORY}; ///< Reused for the completion handlers of the read/write cycle
+
 	 GCommandContainerT<processable_type, networked_consumer_payload_command> m_command_container{
 		 networked_consumer_payload_command::NONE
 	 }; ///< Holds the current command and payload (if any)
@@ -893,6 +1079,24 @@ public:
   	 	return m_n_max_reconnects;
   	 }
 
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Determines whether sessions and clients reuse a fixed memory block for
+	  * their completion handlers instead of allocating memory for each step
+	  * of the read/write cycle
+	  */
+	 void setRecycleHandlerMemory(bool recycle) {
+		 m_recycle_handler_memory = recycle;
+	 }
+
+	 //-------------------------------------------------------------------------
+	 /**
+	  * Allows to check whether handler memory is being recycled
+	  */
+	 bool getRecycleHandlerMemory() const {
+		 return m_recycle_handler_memory;
+	 }
+
 protected:
 	 //-------------------------------------------------------------------------
 	 /**
@@ -940,7 +1144,9 @@ private:
 			 ("asio_nProcessingThreads", po::value<std::size_t>(&m_n_threads)->default_value(GCONSUMERLISTENERTHREADS),
 				 "\t[asio] The number of threads used to process incoming connections")
 			 ("asio_maxReconnects", po::value<std::size_t>(&m_n_max_reconnects)->default_value(GASIOCONSUMERMAXCONNECTIONATTEMPTS),
-			 	 "\t[asio] The maximum number of times a client will try to reconnect to the server when no connection could be established");
+			 	 "\t[asio] The maximum number of times a client will try to reconnect to the server when no connection could be established")
+			 ("asio_recycleHandlerMemory", po::value<bool>(&m_recycle_handler_memory)->default_value(GASIOCONSUMERRECYCLEHANDLERMEMORY),
+				 "\t[asio] Whether sessions and clients reuse a fixed memory block for their completion handlers (1) or allocate memory for each step (0)");
 	 }
 
 	 //-------------------------------------------------------------------------
@@ -1076,6 +1282,7 @@ private:
 				 , [this](std::shared_ptr<processable_type> p) { this->putPayloadItem(p); }
 				 , [this]() -> bool { return this->stopped(); }
 				 , m_serializationMode
+				 , m_recycle_handler_memory
 			 )->async_start_run();
 		 }
 
@@ -1135,6 +1342,7 @@ private:
 				 , m_port
 				 , m_serializationMode
 				 , m_n_max_reconnects
+				 , m_recycle_handler_memory
 			 )
 		 );
 	 }
@@ -1184,6 +1392,7 @@ private:
 	 std::vector<std::thread> m_context_thread_cnt;
 	 std::atomic<std::size_t> m_n_active_sessions{0};
 	 std::size_t m_n_max_reconnects = GASIOCONSUMERMAXCONNECTIONATTEMPTS;
+	 bool m_recycle_handler_memory = GASIOCONSUMERRECYCLEHANDLERMEMORY; ///< Whether completion handlers reuse a per-session memory block
 
 	 std::shared_ptr<typename Gem::Courtier::GBrokerT<processable_type>> m_broker_ptr = GBROKER(processable_type); ///< Simplified access to the broker
 	 const std::chrono::duration<double> m_timeout = std::chrono::milliseconds(GBEASTMSTIMEOUT); ///< A timeout for put- and get-operations via the broker
@@ -538,6 +538,123 @@ public:
 		 return false;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Retrieves up to nMax "raw" items from the next GBufferPortT in a single
+	  * operation and appends them to a vector. The function waits at most for
+	  * the given amount of time for the first item. All items will stem from the
+	  * same buffer port. This allows consumers to fetch work in chunks instead of
+	  * contending for the raw queue with every single item.
+	  *
+	  * @param items A vector to which the retrieved items are appended
+	  * @param nMax The maximum number of items to be retrieved
+	  * @param timeout Time after which the function should time out
+	  * @return The number of items that were retrieved
+	  */
+	 std::size_t get_n(
+		 std::vector<std::shared_ptr<processable_type>>& items
+		 , std::size_t nMax
+		 , std::chrono::duration<double> timeout
+	 ) {
+		 // Retrieve the current buffer port ...
+		 auto rawBuffer_ptr = getNextRawBufferPort();
+		 if(rawBuffer_ptr) {
+			 // ... and get the items from it. This function is thread-safe.
+			 return rawBuffer_ptr->pop_raw_n(items, nMax, timeout);
+		 }
+
+		 // No raw buffer pointer was registered at the time of the getNextRawBufferPort()-call
+		 return 0;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Puts a batch of processed items into their respective processed queues. Items
+	  * are grouped by the id of their buffer port, so each queue is accessed only once
+	  * per batch. Unlike put(), items whose buffer port no longer exists are discarded
+	  * with a warning instead of throwing, as the remaining items of the batch still
+	  * need to be delivered. Empty pointers are ignored. The timeout applies to each
+	  * buffer port separately. Delivered and discarded items are removed from the
+	  * vector, so that upon return it only holds items that could not be submitted
+	  * in time and may be retried by the caller.
+	  *
+	  * @param items The processed items to be submitted; holds the items that timed out upon return
+	  * @param timeout Time after which the submission to a single buffer port should time out
+	  * @return The number of items that could be submitted
+	  */
+	 std::size_t put_n(
+		 std::vector<std::shared_ptr<processable_type>>& items
+		 , std::chrono::duration<double> timeout
+	 ) {
+		 std::size_t nSubmitted = 0;
+		 std::vector<std::shared_ptr<processable_type>> remaining;
+
+		 for(auto& port_items: this->sortByBufferPort(items)) {
+			 // Retrieve the correct processed buffer for this id
+			 auto processedBuffer_ptr = getProcessedBufferPort(port_items.first);
+
+			 if(processedBuffer_ptr) {
+				 // This function is thread-safe. Items are submitted in order.
+				 std::size_t nPortSubmitted = processedBuffer_ptr->push_processed_n(port_items.second, timeout);
+				 remaining.insert(remaining.end(), port_items.second.begin() + nPortSubmitted, port_items.second.end());
+				 nSubmitted += nPortSubmitted;
+			 } else {
+				 glogger
+					 << "In GBrokerT<>::put_n(): Warning!" << std::endl
+					 << "Did not find buffer with id " << port_items.first << "." << std::endl
+					 << port_items.second.size() << " item(s) will be discarded" << std::endl
+					 << GWARNING;
+			 }
+		 }
+
+		 items.swap(remaining);
+		 return nSubmitted;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Hands unprocessed items back to the raw queues of their buffer ports, e.g.
+	  * when a consumer shuts down while still holding work. Items are grouped
+	  * by the id of their buffer port. Items whose buffer port no longer exists
+	  * are discarded with a warning. The timeout applies to each item separately.
+	  * Upon return, the vector only holds items that could not be submitted in time.
+	  *
+	  * @param items The unprocessed items; holds the items that timed out upon return
+	  * @param timeout Time after which the submission of a single item should time out
+	  * @return The number of items that could be handed back
+	  */
+	 std::size_t put_raw_n(
+		 std::vector<std::shared_ptr<processable_type>>& items
+		 , std::chrono::duration<double> timeout
+	 ) {
+		 std::size_t nSubmitted = 0;
+		 std::vector<std::shared_ptr<processable_type>> remaining;
+
+		 for(auto& port_items: this->sortByBufferPort(items)) {
+			 // Raw and processed buffers are held by the same buffer port
+			 auto buffer_ptr = getProcessedBufferPort(port_items.first);
+
+			 if(buffer_ptr) {
+				 for(auto const& item_ptr: port_items.second) {
+					 if(buffer_ptr->push_raw(item_ptr, timeout)) {
+						 nSubmitted++;
+					 } else {
+						 remaining.push_back(item_ptr);
+					 }
+				 }
+			 } else {
+				 glogger
+					 << "In GBrokerT<>::put_raw_n(): Warning!" << std::endl
+					 << "Did not find buffer with id " << port_items.first << "." << std::endl
+					 << port_items.second.size() << " item(s) will be discarded" << std::endl
+					 << GWARNING;
+			 }
+		 }
+
+		 items.swap(remaining);
+		 return nSubmitted;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Checks whether any consumers have been enrolled at the time of calling.
@@ -548,6 +665,16 @@ public:
 		 return m_consumersPresent;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Checks whether the broker has been shut down
+	  *
+	  * @return A boolean indicating whether finalize() has been called
+	  */
+	 bool isFinalized() const {
+		 return m_finalized;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * This function relies on a prior check during the enrolment process whether
@@ -594,6 +721,21 @@ private:
 		 }
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Sorts items according to the id of their buffer port, preserving their
+	  * order. Empty pointers are ignored.
+	  */
+	 std::map<BUFFERPORT_ID_TYPE, std::vector<std::shared_ptr<processable_type>>> sortByBufferPort(
+		 std::vector<std::shared_ptr<processable_type>> const& items
+	 ) const {
+		 std::map<BUFFERPORT_ID_TYPE, std::vector<std::shared_ptr<processable_type>>> itemsPerPort;
+		 for(auto const& p: items) {
+			 if(p) itemsPerPort[p->getBufferId()].push_back(p);
+		 }
+		 return itemsPerPort;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Retrieves the processed buffer pointer for a given id. As we are dealing
@@ -46,6 +46,8 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <vector>
+#include <tuple>
 
 // Boost header files go here
 #include <boost/utility.hpp>
@@ -55,6 +57,7 @@
 #include "courtier/GProcessingContainerT.hpp"
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GBoundedBufferT.hpp"
+#include "common/GErrorStreamer.hpp"
 
 namespace Gem {
 namespace Courtier {
@@ -96,6 +99,17 @@ public:
 
 	 GBufferPortT() = default;
 
+	 /***************************************************************************/
+	 /**
+	  * Initialization with the capacity of the raw buffer, i.e. the maximum number
+	  * of items waiting to be processed
+	  *
+	  * @param rawCapacity The maximum number of items in the raw buffer
+	  */
+	 explicit GBufferPortT(std::size_t rawCapacity) {
+		 m_raw_ptr->setCapacity(rawCapacity);
+	 }
+
 	 ~GBufferPortT() = default;
 
 	 GBufferPortT(GBufferPortT<processable_type> const&) = delete;
@@ -168,6 +182,7 @@ public:
 	 void pop_raw(std::shared_ptr<processable_type> &item_ptr) {
 		 // Do the actual retrieval
 		 m_raw_ptr->pop_and_block_copy(item_ptr);
+		 m_n_raw_retrievals++;
 
 		 if(item_ptr) {
 			 // Make it known to the work item when it was taken from the raw queue for processing
@@ -203,6 +218,7 @@ public:
 			 item_ptr
 			 , timeout
 		 );
+		 if(success) m_n_raw_retrievals++;
 		 if(success && item_ptr) {
 			 // Make it known to the work item when it has returned to its origin
 			 item_ptr->markRawRetrievalTime();
@@ -221,6 +237,46 @@ public:
 		 return success;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Retrieves up to nMax items from the raw queue in a single operation and
+	  * appends them to a vector. The function waits at most for the given amount
+	  * of time for the first item. This allows consumers to fetch work in chunks,
+	  * so that they do not need to lock the raw queue for every single item.
+	  *
+	  * @param items A vector to which the retrieved items are appended
+	  * @param nMax The maximum number of items to be retrieved
+	  * @param timeout duration until a timeout occurs
+	  * @return The number of items that were retrieved
+	  */
+	 std::size_t pop_raw_n(
+		 std::vector<std::shared_ptr<processable_type>> &items
+		 , std::size_t nMax
+		 , const std::chrono::duration<double> &timeout
+	 ) {
+		 std::size_t first_pos = items.size();
+
+		 // Do the actual retrieval
+		 std::size_t nRetrieved = m_raw_ptr->pop_and_wait_n_move(items, nMax, timeout);
+		 m_n_raw_retrievals += nRetrieved;
+		 for(std::size_t pos=first_pos; pos<items.size(); pos++) {
+			 // Make it known to the work item when it was taken from the raw queue for processing
+			 if(items[pos]) items[pos]->markRawRetrievalTime();
+		 }
+
+		 // If this is the first retrieval, mark the time for later usage
+		 if(m_no_retrieval && nRetrieved > 0) {
+			 std::unique_lock<std::mutex> lock(m_first_retrieval_mutex);
+			 if(m_no_retrieval) {
+				 m_retrieval_start_time = std::chrono::high_resolution_clock::now();
+				 m_no_retrieval = false;
+				 m_retrievalTimeCondition.notify_all();
+			 }
+		 }
+
+		 return nRetrieved;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Puts an item into the "processed" queue. This function will block until the item was submitted.
@@ -274,6 +330,43 @@ public:
 		 return success;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Puts a number of processed items into the "processed" queue in a single
+	  * operation. All items need to point somewhere. The number of submitted
+	  * items is returned.
+	  *
+	  * @param items The items to be added to the buffer
+	  * @param timeout duration until a timeout occurs
+	  * @return The number of items that were submitted
+	  */
+	 std::size_t push_processed_n(
+		 std::vector<std::shared_ptr<processable_type>> const &items
+		 , const std::chrono::duration<double> &timeout
+	 ) {
+		 for(auto const& item_ptr: items) {
+			 // Make it known to the work item when it has entered the processed queue
+			 item_ptr->markProcSubmissionTime();
+		 }
+
+		 // The actual submission
+		 std::size_t nSubmitted = m_processed_ptr->push_and_wait_n_copy(items, timeout);
+
+#ifdef DEBUG
+		 // Items may be lost here. This should be a very rare occasion. Emit
+		 // a warning in DEBUG mode, as this might hint at some general problem
+		 if(nSubmitted < items.size()) {
+			 glogger
+				 << "In GBufferPortT<processable_type>::push_processed_n(items, timeout):" << std::endl
+				 << "Only " << nSubmitted << " of " << items.size() << " items could be submitted." << std::endl
+				 << "Timeout was " << timeout.count() << " seconds" << std::endl
+				 << GWARNING;
+		 }
+#endif
+
+		 return nSubmitted;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Retrieves an item from the "processed" queue. This function will usually be
@@ -311,6 +404,7 @@ public:
 			 item_ptr
 			 , timeout
 		 );
+		 if(success) m_n_raw_retrievals++;
 		 if(success && item_ptr) {
 			 // Make it known to the work item when it has returned to its origin
 			 item_ptr->markProcRetrievalTime();
@@ -319,6 +413,106 @@ public:
 		 return success;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Sets the maximum number of items in the raw buffer. If the capacity is
+	  * reduced below the current number of items, no items are removed. Instead,
+	  * submissions will block until the buffer has drained sufficiently.
+	  *
+	  * @param rawCapacity The maximum number of items in the raw buffer
+	  */
+	 void setRawCapacity(std::size_t rawCapacity) {
+		 m_raw_ptr->setCapacity(rawCapacity);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum number of items in the raw buffer
+	  */
+	 std::size_t getRawCapacity() const {
+		 return m_raw_ptr->getCapacity();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the number of items currently waiting in the raw buffer. The
+	  * value may change immediately after this call and can only serve as an indication.
+	  */
+	 std::size_t getNRawItems() const {
+		 return m_raw_ptr->size();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the number of items taken from the raw buffer so far. Unlike the
+	  * fill level, this number only grows, so it shows whether consumers are alive
+	  * even when items are pushed back into the raw buffer in the meantime.
+	  */
+	 std::uint64_t getNRawRetrievals() const {
+		 return m_n_raw_retrievals.load();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sets the fill levels of the raw buffer (as fractions of its capacity) used
+	  * for backpressure. Above the high watermark producers should pause
+	  * submission until the buffer has been drained to the low watermark.
+	  *
+	  * @param lowWatermark The fill level at which submission may resume
+	  * @param highWatermark The fill level at which submission should pause
+	  */
+	 void setWatermarks(double lowWatermark, double highWatermark) {
+		 if(lowWatermark < 0. || lowWatermark > highWatermark || highWatermark > 1.) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GBufferPortT<processable_type>::setWatermarks(): Error!" << std::endl
+					 << "Invalid watermarks " << lowWatermark << " / " << highWatermark << std::endl
+					 << "Need 0 <= low <= high <= 1" << std::endl
+			 );
+		 }
+
+		 m_low_watermark = lowWatermark;
+		 m_high_watermark = highWatermark;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the low and high watermarks of the raw buffer
+	  */
+	 std::tuple<double, double> getWatermarks() const {
+		 return std::make_tuple(m_low_watermark.load(), m_high_watermark.load());
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks whether the raw buffer has reached its high watermark. This is a
+	  * signal to producers that they should pause submission.
+	  *
+	  * @return A boolean indicating whether the fill level of the raw buffer is at or above the high watermark
+	  */
+	 bool raw_above_high_watermark() const {
+		 return static_cast<double>(m_raw_ptr->size()) >= m_high_watermark * static_cast<double>(m_raw_ptr->getCapacity());
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Waits until consumers have drained the raw buffer to the low watermark.
+	  * At least one free slot is always required, so a low watermark of 1
+	  * amounts to waiting for room for the next item. False will be returned if
+	  * this did not happen within the given amount of time.
+	  *
+	  * @param timeout duration until a timeout occurs
+	  * @return A boolean indicating whether the low watermark was reached
+	  */
+	 bool wait_for_low_watermark(const std::chrono::duration<double> &timeout) {
+		 std::size_t capacity = m_raw_ptr->getCapacity();
+		 std::size_t nLow = static_cast<std::size_t>(m_low_watermark * static_cast<double>(capacity));
+		 return m_raw_ptr->wait_for_size_at_most(
+			 (std::min)(nLow, capacity > 0 ? capacity - 1 : 0)
+			 , timeout
+		 );
+	 }
+
 	 /***************************************************************************/
 	 /*
 	  * Retrieves the unique tag that was assigned to this object
@@ -378,7 +572,10 @@ private:
 	 std::chrono::high_resolution_clock::time_point m_retrieval_start_time = std::chrono::high_resolution_clock::now(); ///< Holds the time when the first work item was retrieved from the queue
 	 mutable std::condition_variable m_retrievalTimeCondition; ///< Regulates retrieval of the data in m_retrieval_start_time
 
-	 std::shared_ptr<RAW_BUFFER_TYPE> m_raw_ptr{new RAW_BUFFER_TYPE()}; ///< The queue for raw objects
+	 std::shared_ptr<RAW_BUFFER_TYPE> m_raw_ptr{new RAW_BUFFER_TYPE(DEFAULTRAWBUFFERSIZE)}; ///< The queue for raw objects
+	 std::atomic<std::uint64_t> m_n_raw_retrievals{0}; ///< The number of items taken from the raw queue so far
+	 std::atomic<double> m_low_watermark{DEFAULTRAWBUFFERLOWWATERMARK}; ///< The fill level of the raw buffer at which paused producers may resume
+	 std::atomic<double> m_high_watermark{DEFAULTRAWBUFFERHIGHWATERMARK}; ///< The fill level of the raw buffer at which producers should pause
 	 std::shared_ptr<PROCESSED_BUFFER_TYPE> m_processed_ptr{new PROCESSED_BUFFER_TYPE()}; ///< The queue for processed objects
 
 	 std::atomic<bool> m_connected_to_producer{true}; ///< Indicates whether this object is currently connected to a producer. We assume that this happens upon creation of this object
@@ -103,6 +103,8 @@ const consumerType DEFAULT_BROKER_MODE = consumerType::MULTITHREADED;
  */
 const std::uint32_t GASIOCONSUMERMAXSTALLS = 0; // infinite number of stalls
 const std::uint32_t GASIOCONSUMERMAXCONNECTIONATTEMPTS = 10;
+const bool GASIOCONSUMERRECYCLEHANDLERMEMORY = true; // Whether asio sessions and clients reuse a fixed memory block for their completion handlers
+const std::size_t GASIOHANDLERMEMORYSIZE = 1024; // The size of the memory block reused for asio completion handlers
 const unsigned short GCONSUMERDEFAULTPORT = 10000;
 const std::string GCONSUMERDEFAULTSERVER = "localhost"; // NOLINT
 const std::uint16_t GCONSUMERLISTENERTHREADS = 4;
@@ -147,6 +149,15 @@ const std::uint16_t DEFAULTNSTDTHREADS = 2;
 const std::size_t DEFAULTRAWBUFFERSIZE=Gem::Common::DEFAULTBUFFERSIZE;
 const std::size_t DEFAULTPROCESSEDBUFFERSIZE=Gem::Common::DEFAULTBUFFERSIZE;
 
+/**
+ * Fill levels of the raw buffer of a GBufferPortT, as fractions of its capacity.
+ * Above the high watermark producers are asked to pause submission until consumers
+ * have drained the buffer to the low watermark. The defaults make producers resume
+ * as soon as there is room for a single item, i.e. there is no hysteresis.
+ */
+const double DEFAULTRAWBUFFERLOWWATERMARK=1.;
+const double DEFAULTRAWBUFFERHIGHWATERMARK=1.;
+
 /******************************************************************************/
 /**
  * Needed by the executor to distinguish between successfully processed items,
@@ -212,6 +223,7 @@ const double DEFAULTBROKERWAITFACTOR2 = 1.1; // For GBrokerExecutorT
 const double DEFAULTINITIALBROKERWAITFACTOR2 = 1.;
 
 const std::uint16_t DEFAULTEXECUTORPARTIALRETURNPERCENTAGE = 0; ///< The minimum percentage of returned items in an iteration after which execution will continue
+const std::int64_t DEFAULTBROKERBACKPRESSUREPOLLMS = 100; ///< The interval in which a paused GBrokerExecutorT checks whether the raw buffer has drained
 
 /******************************************************************************/
 /**
@@ -228,6 +240,14 @@ const std::string EMPTYDURATION = "00:00:00.000"; // 0 - no duration  NOLINT
  */
 const std::string DEFAULTBROKERFIRSTTIMEOUT = EMPTYDURATION; // NOLINT
 
+/******************************************************************************/
+/**
+ * The default maximum amount of time a GBrokerExecutorT waits for consumers to
+ * take any item from its full raw buffer, before submission fails. Set it to 0
+ * to wait indefinitely.
+ */
+const std::string DEFAULTBROKERMAXSUBMISSIONSTALL = "01:00:00"; // NOLINT
+
 /******************************************************************************/
 /**
  * The default maximum duration of the calculation.
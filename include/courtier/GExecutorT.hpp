@@ -74,6 +74,7 @@
 #include <boost/serialization/utility.hpp>
 #include <boost/serialization/tracking.hpp>
 #include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
 
 // Geneva headers go here
 #include "common/GCommonInterfaceT.hpp"
@@ -1758,13 +1759,24 @@ class GBrokerExecutorT :
 	 friend class boost::serialization::access;
 
 	 template<typename Archive>
-	 void serialize(Archive &ar, const unsigned int) {
+	 void serialize(Archive &ar, const unsigned int version) {
 		 using boost::serialization::make_nvp;
 
 		 ar
 		 & make_nvp("GBaseExecutorT", boost::serialization::base_object<GBaseExecutorT<processable_type>>(*this))
 		 & BOOST_SERIALIZATION_NVP(m_waitFactor)
-		 & BOOST_SERIALIZATION_NVP(m_minPartialReturnPercentage)
+		 & BOOST_SERIALIZATION_NVP(m_minPartialReturnPercentage);
+
+		 // The raw buffer settings were added in version 1
+		 if(version > 0) {
+			 ar
+			 & BOOST_SERIALIZATION_NVP(m_rawBufferCapacity)
+			 & BOOST_SERIALIZATION_NVP(m_lowWatermark)
+			 & BOOST_SERIALIZATION_NVP(m_highWatermark)
+			 & BOOST_SERIALIZATION_NVP(m_maxSubmissionStall);
+		 }
+
+		 ar
 		 & BOOST_SERIALIZATION_NVP(m_capable_of_full_return)
 		 & BOOST_SERIALIZATION_NVP(m_gpd)
 		 & BOOST_SERIALIZATION_NVP(m_waiting_times_graph)
@@ -1809,6 +1821,10 @@ public:
 		 : GBaseExecutorT<processable_type>(cp)
 		 , m_waitFactor(cp.m_waitFactor)
 		 , m_minPartialReturnPercentage(cp.m_minPartialReturnPercentage)
+		 , m_rawBufferCapacity(cp.m_rawBufferCapacity)
+		 , m_lowWatermark(cp.m_lowWatermark)
+		 , m_highWatermark(cp.m_highWatermark)
+		 , m_maxSubmissionStall(cp.m_maxSubmissionStall)
 		 , m_capable_of_full_return(cp.m_capable_of_full_return)
 		 , m_gpd("Maximum waiting times and returned items", 1, 2) // Intentionally not copied
 		 , m_waitFactorWarningEmitted(cp.m_waitFactorWarningEmitted)
@@ -1882,6 +1898,89 @@ public:
 		 m_minPartialReturnPercentage = minPartialReturnPercentage;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Sets the maximum number of items waiting for processing in the buffer port.
+	  * Note that this setting only takes effect upon the next call to init().
+	  */
+	 void setRawBufferCapacity(std::size_t rawBufferCapacity) {
+		 if(0 == rawBufferCapacity) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GBrokerExecutorT<>::setRawBufferCapacity(): Error!" << std::endl
+					 << "The capacity of the raw buffer must be > 0" << std::endl
+			 );
+		 }
+		 m_rawBufferCapacity = rawBufferCapacity;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum number of items waiting for processing in the buffer port
+	  */
+	 std::size_t getRawBufferCapacity() const noexcept {
+		 return m_rawBufferCapacity;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sets the fill levels of the raw buffer (as fractions of its capacity) used
+	  * for backpressure. Once the high watermark is reached, submission pauses
+	  * until consumers have drained the buffer to the low watermark.
+	  */
+	 void setWatermarks(double lowWatermark, double highWatermark) {
+		 if(lowWatermark < 0. || lowWatermark > highWatermark || highWatermark > 1.) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GBrokerExecutorT<>::setWatermarks(): Error!" << std::endl
+					 << "Invalid watermarks " << lowWatermark << " / " << highWatermark << std::endl
+					 << "Need 0 <= low <= high <= 1" << std::endl
+			 );
+		 }
+
+		 m_lowWatermark = lowWatermark;
+		 m_highWatermark = highWatermark;
+
+		 if(m_current_buffer_port_ptr) {
+			 m_current_buffer_port_ptr->setWatermarks(m_lowWatermark, m_highWatermark);
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the low and high watermarks of the raw buffer
+	  */
+	 std::tuple<double, double> getWatermarks() const noexcept {
+		 return std::make_tuple(m_lowWatermark, m_highWatermark);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sets the maximum amount of time submission may pause without consumers
+	  * removing any item from the full raw buffer. Submission fails with an
+	  * exception once this time has passed, e.g. if all consumers have died.
+	  * A duration of 0 disables this check.
+	  */
+	 void setMaxSubmissionStall(std::chrono::duration<double> maxSubmissionStall) {
+		 if(maxSubmissionStall.count() < 0.) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GBrokerExecutorT<>::setMaxSubmissionStall(): Error!" << std::endl
+					 << "Got negative duration " << maxSubmissionStall.count() << std::endl
+			 );
+		 }
+		 m_maxSubmissionStall = maxSubmissionStall;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum amount of time submission may pause without
+	  * consumers removing any item from the full raw buffer
+	  */
+	 std::chrono::duration<double> getMaxSubmissionStall() const noexcept {
+		 return m_maxSubmissionStall;
+	 }
+
 	/***************************************************************************/
 	/** @brief Allow access to this classes compare_ function */
 	friend void Gem::Common::compare_base_t<GBrokerExecutorT<processable_type>>(
@@ -1913,6 +2012,10 @@ public:
 		 // ... and then our local data
 		 compare_t(IDENTITY(m_waitFactor, p_load->m_waitFactor), token);
 		 compare_t(IDENTITY(m_minPartialReturnPercentage, p_load->m_minPartialReturnPercentage), token);
+		 compare_t(IDENTITY(m_rawBufferCapacity, p_load->m_rawBufferCapacity), token);
+		 compare_t(IDENTITY(m_lowWatermark, p_load->m_lowWatermark), token);
+		 compare_t(IDENTITY(m_highWatermark, p_load->m_highWatermark), token);
+		 compare_t(IDENTITY(m_maxSubmissionStall.count(), p_load->m_maxSubmissionStall.count()), token); // Cannot directly compare std::chrono::duration<double>
 		 compare_t(IDENTITY(m_capable_of_full_return, p_load->m_capable_of_full_return), token);
 		 compare_t(IDENTITY(m_waitFactorWarningEmitted, p_load->m_waitFactorWarningEmitted), token);
 
@@ -1943,6 +2046,10 @@ protected:
 		 // Local data
 		 m_waitFactor = p_load_ptr->m_waitFactor;
 		 m_minPartialReturnPercentage = p_load_ptr->m_minPartialReturnPercentage;
+		 m_rawBufferCapacity = p_load_ptr->m_rawBufferCapacity;
+		 m_lowWatermark = p_load_ptr->m_lowWatermark;
+		 m_highWatermark = p_load_ptr->m_highWatermark;
+		 m_maxSubmissionStall = p_load_ptr->m_maxSubmissionStall;
 		 m_capable_of_full_return = p_load_ptr->m_capable_of_full_return;
 		 m_waitFactorWarningEmitted = p_load_ptr->m_waitFactorWarningEmitted;
 	 }
@@ -1958,9 +2065,12 @@ protected:
 		 // Make sure we have a valid buffer port
 		 if (not m_current_buffer_port_ptr) {
 			 m_current_buffer_port_ptr.reset(
-				 new Gem::Courtier::GBufferPortT<processable_type>()
+				 new Gem::Courtier::GBufferPortT<processable_type>(m_rawBufferCapacity)
 			 );
+		 } else {
+			 m_current_buffer_port_ptr->setRawCapacity(m_rawBufferCapacity);
 		 }
+		 m_current_buffer_port_ptr->setWatermarks(m_lowWatermark, m_highWatermark);
 
 		 // Add the buffer port to the broker and check whether all consumers
 		 // enrolled with the broker are capable of full return
@@ -2098,6 +2208,43 @@ protected:
 				<< "Set to a value < 100 to allow execution to continue when" << std::endl
 				<< "minPartialReturnPercentage percent of the expected work items"  << std::endl
 				<< "have returned. Set to 0 to disable this option.";
+
+		gpb.registerFileParameter<std::size_t>(
+				"rawBufferCapacity" // The name of the variable
+				, DEFAULTRAWBUFFERSIZE // The default value
+				, [this](std::size_t c) {
+					this->setRawBufferCapacity(c);
+				}
+		)
+				<< "The maximum number of work items waiting for processing" << std::endl
+				<< "in the broker. Must be > 0.";
+
+		gpb.registerFileParameter<double, double>(
+				"lowWatermark" // The name of the first variable
+				, "highWatermark" // The name of the second variable
+				, DEFAULTRAWBUFFERLOWWATERMARK // The default value of the first variable
+				, DEFAULTRAWBUFFERHIGHWATERMARK // The default value of the second variable
+				, [this](double low, double high) {
+					this->setWatermarks(low, high);
+				}
+				, "rawBufferWatermarks"
+		)
+				<< "The fill level of the raw buffer (as a fraction of its capacity)" << std::endl
+				<< "at which paused submission resumes" << Gem::Common::nextComment()
+				<< "The fill level of the raw buffer (as a fraction of its capacity)" << std::endl
+				<< "at which submission pauses until the low watermark is reached";
+
+		gpb.registerFileParameter<std::string>(
+				"maxSubmissionStall" // The name of the variable
+				, DEFAULTBROKERMAXSUBMISSIONSTALL // The default value
+				, [this](std::string ms_str) {
+					this->setMaxSubmissionStall(Gem::Common::duration_from_string(ms_str));
+				}
+		)
+				<< "The maximum amount of time (in the format hh:mm:ss.xxx) submission" << std::endl
+				<< "may pause without consumers taking any item from the full" << std::endl
+				<< "raw buffer, before submission fails. Use 00:00:00.000 to wait" << std::endl
+				<< "indefinitely.";
 	}
 
 	/***************************************************************************/
@@ -2128,10 +2275,62 @@ protected:
 		 // Store the id of the buffer port in the item
 		 w_ptr->setBufferId(m_current_buffer_port_ptr->getUniqueTag());
 
+		 // Pause submission until consumers have drained the raw buffer to the low
+		 // watermark, rather than waking up for every single free slot
+		 if(m_current_buffer_port_ptr->raw_above_high_watermark()) {
+			 this->waitForRawBufferDrain();
+		 }
+
 		 // Perform the actual submission
 		 m_current_buffer_port_ptr->push_raw(w_ptr);
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Waits until consumers have drained the raw buffer to the low watermark.
+	  * Throws if the broker has been shut down in the meantime or if consumers
+	  * have not taken a single item from the buffer for longer than m_maxSubmissionStall.
+	  */
+	 void waitForRawBufferDrain() {
+		 const std::chrono::milliseconds poll(DEFAULTBROKERBACKPRESSUREPOLLMS);
+
+		 auto stall_start = std::chrono::steady_clock::now();
+		 std::uint64_t nRetrievals = m_current_buffer_port_ptr->getNRawRetrievals();
+
+		 while(not m_current_buffer_port_ptr->wait_for_low_watermark(poll)) {
+			 if(GBROKER(processable_type)->isFinalized()) {
+				 throw gemfony_exception(
+					 g_error_streamer(DO_LOG, time_and_place)
+						 << "In GBrokerExecutorT::waitForRawBufferDrain(): Error!" << std::endl
+						 << "The broker was shut down while submission was paused" << std::endl
+				 );
+			 }
+
+			 // Consumers may push unprocessed items back into the raw buffer (see
+			 // GBrokerT::put_raw_n()), so its fill level does not tell whether they are
+			 // alive. Any new retrieval does.
+			 std::uint64_t nRetrievalsNow = m_current_buffer_port_ptr->getNRawRetrievals();
+			 if(nRetrievalsNow != nRetrievals) {
+				 nRetrievals = nRetrievalsNow;
+				 stall_start = std::chrono::steady_clock::now();
+				 continue;
+			 }
+
+			 if(
+				 m_maxSubmissionStall.count() > 0.
+				 && std::chrono::steady_clock::now() - stall_start >= m_maxSubmissionStall
+			 ) {
+				 throw gemfony_exception(
+					 g_error_streamer(DO_LOG, time_and_place)
+						 << "In GBrokerExecutorT::waitForRawBufferDrain(): Error!" << std::endl
+						 << "No consumer has taken an item from the full raw buffer" << std::endl
+						 << "for " << m_maxSubmissionStall.count() << " seconds." << std::endl
+						 << "Consumers may have died. Check the setting of maxSubmissionStall." << std::endl
+				 );
+			 }
+		 }
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Waits for all items to return or possibly until a timeout has been reached.
@@ -2661,6 +2860,11 @@ private:
 
 	 std::uint16_t m_minPartialReturnPercentage = DEFAULTEXECUTORPARTIALRETURNPERCENTAGE; ///< Minimum percentage of returned items after which execution continues
 
+	 std::size_t m_rawBufferCapacity = DEFAULTRAWBUFFERSIZE; ///< The maximum number of items waiting for processing in the buffer port
+	 double m_lowWatermark = DEFAULTRAWBUFFERLOWWATERMARK; ///< The fill level of the raw buffer at which paused submission resumes
+	 double m_highWatermark = DEFAULTRAWBUFFERHIGHWATERMARK; ///< The fill level of the raw buffer at which submission pauses
+	 std::chrono::duration<double> m_maxSubmissionStall = Gem::Common::duration_from_string(DEFAULTBROKERMAXSUBMISSIONSTALL); ///< The maximum time submission may pause without consumers making progress
+
 	 GBufferPortT_ptr m_current_buffer_port_ptr; ///< Holds a GBufferPortT object during the calculation. Note: It is neither serialized nor copied
 
 	 bool m_capable_of_full_return = false; ///< Indicates whether the broker may return results without losses
@@ -2709,4 +2913,18 @@ struct is_abstract<const Gem::Courtier::GBaseExecutorT<processable_type>> : publ
 }
 
 /******************************************************************************/
+// The version of GBrokerExecutorT<>. This is the content of BOOST_CLASS_VERSION(T, 1)
+
+namespace boost {
+namespace serialization {
+template<typename processable_type>
+struct version<Gem::Courtier::GBrokerExecutorT<processable_type>> {
+	typedef mpl::int_<1> type;
+	typedef mpl::integral_c_tag tag;
+	BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+}
+}
+
+/******************************************************************************/
 
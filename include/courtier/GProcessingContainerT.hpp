@@ -592,10 +592,12 @@ public:
 
 	 /***************************************************************************/
 	 /**
-	  * Marks this item as being due for processing.
+	  * Marks this item as being due for processing. Derived classes are notified
+	  * through markedAsDueForProcessing_().
 	  */
 	 void mark_as_due_for_processing() {
 		 m_processing_status = processingStatus::DO_PROCESS;
+		 this->markedAsDueForProcessing_();
 	 }
 
 	 /***************************************************************************/
@@ -974,6 +976,14 @@ private:
 	 virtual void loadConstantData_(std::shared_ptr<processable_type>) BASE
 	 { /* nothing */ }
 
+	 /***************************************************************************/
+	 /**
+	  * Called whenever this item is marked as due for processing. This allows derived
+	  * classes to discard data that depends on the state which was processed last.
+	  */
+	 virtual void markedAsDueForProcessing_() BASE
+	 { /* nothing */ }
+
 	 /***************************************************************************/
 
 	 /** @brief Allows derived classes to specify the tasks to be performed for this object */
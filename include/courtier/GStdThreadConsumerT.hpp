@@ -44,8 +44,11 @@
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <deque>
+#include <memory>
 #include <algorithm>
 #include <functional>
+#include <chrono>
 
 // Boost headers go here
 
@@ -68,6 +71,165 @@ namespace Courtier {
 /** @brief The default number of threads per worker if the number of hardware threads cannot be determined */
 const std::uint16_t DEFAULTTHREADSPERWORKER = 4;
 
+/** @brief The default number of work items a thread fetches from the broker and returns in one go */
+const std::size_t DEFAULTSTCCHUNKSIZE = 4;
+
+/** @brief The default time in milliseconds after which a partially filled return batch is handed to the broker */
+const std::int64_t DEFAULTSTCMAXBATCHAGEMS = 100;
+
+/** @brief The time in milliseconds allowed for returning left-over items to the broker upon shutdown */
+const std::int64_t DEFAULTSTCSHUTDOWNTIMEOUTMS = 200;
+
+/******************************************************************************/
+/**
+ * Private work queues of a group of threads, as used by GStdThreadConsumerT.
+ * Each thread appends chunks of work to its own queue and takes items from its
+ * front. Threads whose queue has run dry may steal items from the back of their
+ * siblings' queues.
+ */
+template<typename item_type>
+class GLocalWorkQueuesT {
+public:
+	 /***************************************************************************/
+
+	 GLocalWorkQueuesT() = default;
+
+	 /***************************************************************************/
+	 /**
+	  * Initialization with the number of queues, i.e. threads
+	  */
+	 explicit GLocalWorkQueuesT(std::size_t nQueues) {
+		 this->reset(nQueues);
+	 }
+
+	 /***************************************************************************/
+
+	 GLocalWorkQueuesT(const GLocalWorkQueuesT<item_type> &) = delete; ///< Intentionally left undefined
+	 GLocalWorkQueuesT<item_type> &operator=(const GLocalWorkQueuesT<item_type> &) = delete; ///< Intentionally left undefined
+
+	 /***************************************************************************/
+	 /**
+	  * Replaces all queues by nQueues empty queues. Must not be called while
+	  * other threads access the queues.
+	  */
+	 void reset(std::size_t nQueues) {
+		 m_queues.clear();
+		 for(std::size_t queue_id = 0; queue_id < nQueues; queue_id++) {
+			 m_queues.push_back(std::unique_ptr<local_queue>(new local_queue()));
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the number of queues
+	  */
+	 std::size_t size() const {
+		 return m_queues.size();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Hands out the first item of a chunk and appends the others to the back
+	  * of the given queue. An empty pointer is returned for an empty chunk.
+	  *
+	  * @param queue_id The id of the queue the remainder of the chunk is stored in
+	  * @param chunk The chunk of items, which will be empty after the call
+	  * @return The first item of the chunk
+	  */
+	 std::shared_ptr<item_type> distribute(
+		 std::size_t queue_id
+		 , std::vector<std::shared_ptr<item_type>>& chunk
+	 ) {
+		 std::shared_ptr<item_type> p;
+		 if(chunk.empty()) return p;
+
+		 p = chunk.front();
+		 if(chunk.size() > 1) {
+			 auto& lq = *m_queues.at(queue_id);
+			 std::unique_lock<std::mutex> lock(lq.m_mutex);
+			 lq.m_items.insert(lq.m_items.end(), chunk.begin() + 1, chunk.end());
+		 }
+		 chunk.clear();
+
+		 return p;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves an item from the front of a queue or an empty pointer,
+	  * if the queue is empty
+	  */
+	 std::shared_ptr<item_type> pop(std::size_t queue_id) {
+		 auto& lq = *m_queues.at(queue_id);
+		 std::unique_lock<std::mutex> lock(lq.m_mutex);
+
+		 std::shared_ptr<item_type> p;
+		 if(not lq.m_items.empty()) {
+			 p = lq.m_items.front();
+			 lq.m_items.pop_front();
+		 }
+
+		 return p;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Steals an item from the back of the next non-empty sibling queue, starting
+	  * with the queue following our own. An empty pointer is returned if all
+	  * siblings are empty.
+	  */
+	 std::shared_ptr<item_type> steal(std::size_t queue_id) {
+		 std::shared_ptr<item_type> p;
+
+		 for(std::size_t offset = 1; offset < m_queues.size(); offset++) {
+			 auto& lq = *m_queues[(queue_id + offset) % m_queues.size()];
+			 std::unique_lock<std::mutex> lock(lq.m_mutex);
+			 if(not lq.m_items.empty()) {
+				 p = lq.m_items.back();
+				 lq.m_items.pop_back();
+				 break;
+			 }
+		 }
+
+		 return p;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks whether a queue is empty
+	  */
+	 bool empty(std::size_t queue_id) const {
+		 auto& lq = *m_queues.at(queue_id);
+		 std::unique_lock<std::mutex> lock(lq.m_mutex);
+		 return lq.m_items.empty();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Removes all items from all queues and returns them
+	  */
+	 std::vector<std::shared_ptr<item_type>> drain() {
+		 std::vector<std::shared_ptr<item_type>> items;
+		 for(auto& lq_ptr: m_queues) {
+			 std::unique_lock<std::mutex> lock(lq_ptr->m_mutex);
+			 items.insert(items.end(), lq_ptr->m_items.begin(), lq_ptr->m_items.end());
+			 lq_ptr->m_items.clear();
+		 }
+		 return items;
+	 }
+
+private:
+	 /***************************************************************************/
+
+	 /** @brief A single queue together with the mutex protecting it */
+	 struct local_queue {
+		 mutable std::mutex m_mutex;
+		 std::deque<std::shared_ptr<item_type>> m_items;
+	 };
+
+	 std::vector<std::unique_ptr<local_queue>> m_queues; ///< One private queue per thread
+};
+
 /******************************************************************************/
 /**
  * A derivative of GBaseConsumerT<>, that processes items in separate threads.
@@ -75,6 +237,16 @@ const std::uint16_t DEFAULTTHREADSPERWORKER = 4;
  * accepts more than one consumer. You can thus use this class to aid networked
  * optimization, if the server has spare CPU cores that would otherwise run idle.
  * The class makes use of the template arguments' process() function.
+ *
+ * In order to reduce contention on the broker's buffers, each thread fetches
+ * work items in chunks into a private queue and returns processed items in
+ * batches. Threads whose private queue has run dry steal items from their
+ * siblings before waiting for new work from the broker. A chunk size of 1
+ * results in item-by-item exchange with the broker. Partially filled batches
+ * are returned once they reach a maximum age, so processed items do not wait
+ * for the remainder of a chunk. Upon shutdown, processed items still held by
+ * the threads are returned and unprocessed items are handed back to the raw
+ * queues of the broker.
  */
 template<class processable_type>
 class GStdThreadConsumerT
@@ -130,6 +302,62 @@ public:
 		 return m_nThreads;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Sets the number of work items each thread fetches from the broker and
+	  * returns to it in one go. Note that this function will only have an effect
+	  * before the threads have been started. A chunk size of 0 will be reset to 1.
+	  *
+	  * @param chunkSize The number of items exchanged with the broker in one go
+	  */
+	 void setChunkSize(std::size_t chunkSize) {
+		 if(0 == chunkSize) {
+			 glogger
+				 << "In GStdThreadConsumerT::setChunkSize(chunkSize):" << std::endl
+				 << "chunkSize == 0 was requested. chunkSize was reset to 1" << std::endl
+				 << GWARNING;
+
+			 m_chunkSize = 1;
+		 } else {
+			 m_chunkSize = chunkSize;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the number of work items each thread exchanges with the broker in one go
+	  *
+	  * @return The number of work items each thread exchanges with the broker in one go
+	  */
+	 std::size_t getChunkSize() const {
+		 return m_chunkSize;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sets the maximum amount of time a processed item may be held in a
+	  * partially filled return batch, before the batch is handed to the broker.
+	  * The age is checked whenever an item has been processed. Batches are
+	  * handed over immediately when a single evaluation takes at least this
+	  * long, so that items wait less than twice this amount of time.
+	  *
+	  * @param maxBatchAge The maximum age of a partially filled return batch
+	  */
+	 void setMaxBatchAge(std::chrono::milliseconds maxBatchAge) {
+		 m_maxBatchAge = maxBatchAge;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum amount of time a processed item may be held in a
+	  * partially filled return batch
+	  *
+	  * @return The maximum age of a partially filled return batch
+	  */
+	 std::chrono::milliseconds getMaxBatchAge() const {
+		 return m_maxBatchAge;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Allows to check whether a worker template was registered
@@ -205,6 +433,12 @@ protected:
 		 // Wait for local workers to terminate
 		 m_gtg.join_all();
 		 m_workers.clear();
+
+		 // Items held by the threads would otherwise be lost
+		 this->returnLeftOvers();
+
+		 m_local_queues.reset(0);
+		 m_outgoing_batches.clear();
 	 }
 
 	 /***************************************************************************/
@@ -229,6 +463,23 @@ protected:
 			 << "Indicates the number of threads used to process each worker." << std::endl
 			 << "Setting threadsPerWorker to 0 will result in an attempt to" << std::endl
 			 << "automatically determine the number of hardware threads.";
+
+		 gpb.registerFileParameter<std::size_t>(
+			 "chunkSize" // The name of the variable
+			 , DEFAULTSTCCHUNKSIZE // The default value
+			 , [this](std::size_t cs) { this->setChunkSize(cs); }
+		 )
+			 << "The number of work items each thread fetches from the broker" << std::endl
+			 << "and returns to it in one go. Use 1 for item-by-item exchange.";
+
+		 gpb.registerFileParameter<std::int64_t>(
+			 "maxBatchAgeMS" // The name of the variable
+			 , DEFAULTSTCMAXBATCHAGEMS // The default value
+			 , [this](std::int64_t ms) { this->setMaxBatchAge(std::chrono::milliseconds(ms)); }
+		 )
+			 << "The maximum amount of time in milliseconds a processed item" << std::endl
+			 << "may wait in a partially filled return batch. The age is checked" << std::endl
+			 << "after each evaluation, so items may wait up to twice this time.";
 	 }
 
 private:
@@ -252,14 +503,20 @@ private:
 		 hidden.add_options()
 			 ("stcCapableOfFullReturn", po::value<bool>(&m_capableOfFullReturn)->default_value(m_capableOfFullReturn),
 				 "\t[stc] A debugging option making the multi-threaded consumer use timeouts in the executor");
+
+		 hidden.add_options()
+			 ("stcChunkSize", po::value<std::size_t>(&m_chunkSize)->default_value(m_chunkSize),
+				 "\t[stc] The number of work items each thread fetches from and returns to the broker in one go");
 	 }
 
 	 /***************************************************************************/
 	 /**
 	  * Takes a boost::program_options::variables_map object and checks for supplied options.
 	  */
-	 void actOnCLOptions_(const boost::program_options::variables_map &vm) override
-	 { /* nothing */ }
+	 void actOnCLOptions_(const boost::program_options::variables_map &vm) override {
+		 // Make sure we have a sensible chunk size
+		 if(0 == m_chunkSize) this->setChunkSize(0);
+	 }
 
 	 /***************************************************************************/
 	 /**
@@ -319,6 +576,15 @@ private:
 		 glogger
 			 << "Starting " << m_nThreads << " processing threads in GStdThreadConsumerT<processable_type>" << std::endl
 			 << GLOGGING;
+
+		 // Set up the private queues and return batches of all threads
+		 m_local_queues.reset(m_nThreads);
+		 m_outgoing_batches.clear();
+		 m_outgoing_batches.resize(m_nThreads);
+		 for(auto& batch: m_outgoing_batches) {
+			 batch.m_items.reserve(m_chunkSize);
+		 }
+
 		 for (std::size_t worker_id = 0; worker_id < m_nThreads; worker_id++) {
 			 // The actual worker
 			 std::shared_ptr<GLocalConsumerWorkerT<processable_type>> p_worker
@@ -330,18 +596,16 @@ private:
 					 //----------------------
 					 worker_id
 					 //----------------------
-					 , [this](
+					 , [this, worker_id](
 						 const std::chrono::milliseconds& timeout
 					 ) -> std::shared_ptr<processable_type> {
-						 std::shared_ptr<processable_type> p;
-						 m_broker_ptr->get(p, timeout);
-						 return p;
+						 return this->retrieveItem(worker_id, timeout);
 					 }
 					 //----------------------
-					 , [this](
+					 , [this, worker_id](
 						 std::shared_ptr<processable_type> p
 						 , const std::chrono::milliseconds& timeout
-					 ) -> void { m_broker_ptr->put(p, timeout); }
+					 ) -> void { this->submitItem(worker_id, p, timeout); }
 					 //----------------------
 					 , [this]() -> bool { return this->stopped(); }
 					 //----------------------
@@ -361,6 +625,148 @@ private:
 		 }
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Retrieves a work item for a given thread. Items are taken from the thread's
+	  * private queue first. If it is empty, a chunk of items is fetched from the
+	  * broker without waiting. If the broker has no work either, the thread tries
+	  * to steal an item from its siblings, before finally waiting for new work
+	  * from the broker. An empty pointer is returned if no item could be obtained.
+	  *
+	  * @param worker_id The id of the calling thread
+	  * @param timeout The maximum amount of time to wait for new work from the broker
+	  * @return A work item or an empty pointer
+	  */
+	 std::shared_ptr<processable_type> retrieveItem(
+		 std::size_t worker_id
+		 , const std::chrono::milliseconds& timeout
+	 ) {
+		 std::shared_ptr<processable_type> p;
+
+		 if(
+			 not (p = m_local_queues.pop(worker_id)) // Try our private queue first
+			 && not (p = this->fetchChunk(worker_id, std::chrono::milliseconds(0))) // Fetch a new chunk from the broker, if work is readily available
+			 && not (p = m_local_queues.steal(worker_id)) // Help out our siblings
+		 ) {
+			 // Items that could not be returned earlier should not wait for new work
+			 if(not m_outgoing_batches.at(worker_id).m_items.empty()) {
+				 this->flushBatch(worker_id, timeout);
+			 }
+
+			 // Wait for new work
+			 p = this->fetchChunk(worker_id, timeout);
+		 }
+
+		 // Processing of the item starts now (see submitItem())
+		 m_outgoing_batches.at(worker_id).m_processing_start = std::chrono::steady_clock::now();
+
+		 return p;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Adds a processed item to the return batch of a given thread. The batch is
+	  * handed to the broker once it is full, once its oldest item has exceeded the
+	  * maximum batch age or when the thread's private queue has run dry, so that
+	  * processed items do not linger while the thread works on or waits for
+	  * other items. As the age can only be checked between evaluations, the batch
+	  * is also handed over when the evaluation of the item took at least as long
+	  * as the maximum batch age, so that the next (likely similarly long) evaluation
+	  * does not delay it. A processed item thus waits less than twice the maximum
+	  * batch age, unless the broker does not accept it in time.
+	  *
+	  * @param worker_id The id of the calling thread
+	  * @param p The processed item
+	  * @param timeout The maximum amount of time to wait for the submission to a buffer port
+	  */
+	 void submitItem(
+		 std::size_t worker_id
+		 , std::shared_ptr<processable_type> p
+		 , const std::chrono::milliseconds& timeout
+	 ) {
+		 // Only the thread with this id accesses its return batch, so no locking is needed
+		 auto& batch = m_outgoing_batches.at(worker_id);
+		 auto now = std::chrono::steady_clock::now();
+		 if(batch.m_items.empty()) {
+			 batch.m_oldest = now;
+		 }
+		 batch.m_items.push_back(p);
+
+		 if(
+			 batch.m_items.size() >= m_chunkSize
+			 || m_local_queues.empty(worker_id)
+			 || now - batch.m_oldest >= m_maxBatchAge
+			 || now - batch.m_processing_start >= m_maxBatchAge
+		 ) {
+			 this->flushBatch(worker_id, timeout);
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Hands the return batch of a given thread to the broker. Items that could
+	  * not be submitted in time remain in the batch and are retried with the next
+	  * submission.
+	  */
+	 void flushBatch(
+		 std::size_t worker_id
+		 , const std::chrono::milliseconds& timeout
+	 ) {
+		 auto& batch = m_outgoing_batches.at(worker_id);
+		 m_broker_ptr->put_n(batch.m_items, timeout);
+
+		 if(not batch.m_items.empty()) {
+			 glogger
+				 << "In GStdThreadConsumerT<processable_type>::flushBatch():" << std::endl
+				 << batch.m_items.size() << " processed item(s) could not be returned in time." << std::endl
+				 << "Submission will be retried." << std::endl
+				 << GWARNING;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves up to m_chunkSize items from the broker. The first item is
+	  * returned, the others are stored in the thread's private queue.
+	  */
+	 std::shared_ptr<processable_type> fetchChunk(
+		 std::size_t worker_id
+		 , const std::chrono::milliseconds& timeout
+	 ) {
+		 std::vector<std::shared_ptr<processable_type>> chunk;
+		 m_broker_ptr->get_n(chunk, m_chunkSize, timeout);
+		 return m_local_queues.distribute(worker_id, chunk);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Returns processed items still held in the return batches to the broker and
+	  * hands unprocessed items in the private queues back to the raw queues of
+	  * their buffer ports, so other consumers may process them. This function
+	  * must only be called after all threads have terminated.
+	  */
+	 void returnLeftOvers() {
+		 const std::chrono::milliseconds timeout(DEFAULTSTCSHUTDOWNTIMEOUTMS);
+
+		 std::size_t nLost = 0;
+		 for(auto& batch: m_outgoing_batches) {
+			 m_broker_ptr->put_n(batch.m_items, timeout);
+			 nLost += batch.m_items.size();
+			 batch.m_items.clear();
+		 }
+
+		 auto unprocessed = m_local_queues.drain();
+		 m_broker_ptr->put_raw_n(unprocessed, timeout);
+		 nLost += unprocessed.size();
+
+		 if(nLost > 0) {
+			 glogger
+				 << "In GStdThreadConsumerT<processable_type>::returnLeftOvers():" << std::endl
+				 << nLost << " item(s) could not be returned to the broker upon shutdown" << std::endl
+				 << GWARNING;
+		 }
+	 }
+
 	 /***************************************************************************/
 	 /**
   	 * Returns the (possibly estimated) number of concurrent processing units.
@@ -394,12 +800,24 @@ private:
 	 bool m_capableOfFullReturn = true; ///< Indicates whether this consumer is capable of full return
 
 	 std::size_t m_nThreads = DEFAULTTHREADSPERWORKER; ///< The maximum number of allowed threads in the pool
+	 std::size_t m_chunkSize = DEFAULTSTCCHUNKSIZE; ///< The number of work items each thread exchanges with the broker in one go
+	 std::chrono::milliseconds m_maxBatchAge = std::chrono::milliseconds(DEFAULTSTCMAXBATCHAGEMS); ///< The maximum time a processed item may wait in a partially filled return batch
 	 Gem::Common::GThreadGroup m_gtg; ///< Holds the processing threads
 
 	 std::vector<std::shared_ptr<GLocalConsumerWorkerT<processable_type>>> m_workers; ///< Holds the current worker objects
 	 std::shared_ptr<GLocalConsumerWorkerT<processable_type>> m_workerTemplate; ///< All workers will be created as a clone of this worker
 
 	 std::shared_ptr<GBrokerT<processable_type>> m_broker_ptr = GBROKER(processable_type); ///< A shortcut to the broker so we do not have to go through the singleton
+
+	 /** @brief Processed items waiting to be returned to the broker */
+	 struct outgoing_batch {
+		 std::vector<std::shared_ptr<processable_type>> m_items; ///< The processed items
+		 std::chrono::steady_clock::time_point m_oldest; ///< The time the oldest item was added
+		 std::chrono::steady_clock::time_point m_processing_start; ///< The time the thread started processing its current item
+	 };
+
+	 GLocalWorkQueuesT<processable_type> m_local_queues; ///< One private queue per thread
+	 std::vector<outgoing_batch> m_outgoing_batches; ///< Processed items waiting to be returned, one batch per thread
 };
 
 /******************************************************************************/
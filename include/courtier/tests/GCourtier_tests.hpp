@@ -0,0 +1,83 @@
+/**
+ * @file GCourtier_tests.hpp
+ *
+ * Tests for the courtier library.
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard header files go here
+
+// Boost header files go here
+
+// Geneva header files go here
+#include "courtier/tests/GStdThreadConsumerT_tests.hpp"
+
+using namespace Gem::Courtier;
+using namespace Gem::Courtier::Tests;
+
+using boost::unit_test_framework::test_suite;
+using boost::unit_test_framework::test_case;
+
+/********************************************************************************************/
+/**
+ * This test suite checks as much as possible of the functionality provided
+ * by the courtier library.
+ */
+class GCourtierSuite: public test_suite
+{
+public:
+	 GCourtierSuite() :test_suite("GCourtierSuite") {
+		 // create an instance of the test cases class
+		 boost::shared_ptr<GStdThreadConsumerT_tests> instance(new GStdThreadConsumerT_tests());
+
+		 test_case* GStdThreadConsumerT_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GStdThreadConsumerT_tests::no_failure_expected, instance);
+		 test_case* GStdThreadConsumerT_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GStdThreadConsumerT_tests::failures_expected, instance);
+
+		 add(GStdThreadConsumerT_no_failure_expected_test_case);
+		 add(GStdThreadConsumerT_failures_expected_test_case);
+	 }
+};
+
+/********************************************************************************************/
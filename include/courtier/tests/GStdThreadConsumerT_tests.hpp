@@ -0,0 +1,366 @@
+/**
+ * @file GStdThreadConsumerT_tests.hpp
+ *
+ * Tests of the work distribution machinery of the GStdThreadConsumerT class
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <thread>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "courtier/GStdThreadConsumerT.hpp"
+#include "courtier/GBrokerT.hpp"
+#include "courtier/GBufferPortT.hpp"
+#include "courtier/GExecutorT.hpp"
+#include "courtier/GDemoProcessingContainers.hpp"
+
+namespace Gem {
+namespace Courtier {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * A container whose processing takes a given amount of time, used to check
+ * how long processed items are held back by GStdThreadConsumerT. It records
+ * when its processing has finished.
+ */
+class GSlowContainer
+	: public GSimpleContainer
+{
+public:
+	 GSlowContainer(std::size_t n, std::chrono::milliseconds duration)
+		 : GSimpleContainer(n)
+		 , m_duration(duration)
+	 { /* nothing */ }
+
+	 /** @brief Retrieves the time when the processing of this item finished */
+	 std::chrono::high_resolution_clock::time_point getProcessingEndTime() const {
+		 return m_processing_end;
+	 }
+
+private:
+	 void process_() override {
+		 std::this_thread::sleep_for(m_duration);
+		 m_processing_end = std::chrono::high_resolution_clock::now();
+	 }
+
+	 std::chrono::milliseconds m_duration;
+	 std::chrono::high_resolution_clock::time_point m_processing_end;
+};
+
+/******************************************************************************/
+/**
+ * Unit tests for the private work queues and the batch exchange with the broker
+ * used by GStdThreadConsumerT
+ */
+class GStdThreadConsumerT_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 using item_ptr_type = std::shared_ptr<GSimpleContainer>;
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that chunks are distributed to the private queues in order
+			 GLocalWorkQueuesT<GSimpleContainer> queues(3);
+			 BOOST_CHECK(queues.size() == 3);
+			 for(std::size_t q = 0; q < queues.size(); q++) {
+				 BOOST_CHECK(queues.empty(q));
+				 BOOST_CHECK(!queues.pop(q));
+				 BOOST_CHECK(!queues.steal(q));
+			 }
+
+			 // An empty chunk does not result in an item
+			 std::vector<item_ptr_type> chunk;
+			 BOOST_CHECK(!queues.distribute(0, chunk));
+			 BOOST_CHECK(queues.empty(0));
+
+			 std::vector<item_ptr_type> items;
+			 for(std::size_t i = 0; i < 5; i++) items.push_back(std::make_shared<GSimpleContainer>(i));
+
+			 // The first item is handed out, the remainder is stored in the queue
+			 chunk = items;
+			 BOOST_CHECK(queues.distribute(0, chunk) == items[0]);
+			 BOOST_CHECK(chunk.empty());
+			 BOOST_CHECK(!queues.empty(0));
+			 BOOST_CHECK(queues.empty(1));
+			 BOOST_CHECK(queues.empty(2));
+
+			 // The owner takes items from the front
+			 BOOST_CHECK(queues.pop(0) == items[1]);
+			 BOOST_CHECK(queues.pop(0) == items[2]);
+
+			 // Siblings steal from the back
+			 BOOST_CHECK(!queues.pop(1));
+			 BOOST_CHECK(queues.steal(1) == items[4]);
+			 BOOST_CHECK(queues.steal(2) == items[3]);
+
+			 // Nothing is left to steal
+			 BOOST_CHECK(queues.empty(0));
+			 BOOST_CHECK(!queues.steal(1));
+			 BOOST_CHECK(!queues.steal(0));
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that steal() visits the sibling queues starting with the next one
+			 GLocalWorkQueuesT<GSimpleContainer> queues(3);
+
+			 std::vector<item_ptr_type> chunk_0 {std::make_shared<GSimpleContainer>(0), std::make_shared<GSimpleContainer>(1)};
+			 std::vector<item_ptr_type> chunk_1 {std::make_shared<GSimpleContainer>(2), std::make_shared<GSimpleContainer>(3)};
+			 auto stolen_from_0 = chunk_0.back();
+			 auto stolen_from_1 = chunk_1.back();
+			 queues.distribute(0, chunk_0);
+			 queues.distribute(1, chunk_1);
+
+			 BOOST_CHECK(queues.steal(2) == stolen_from_0); // Queue 0 follows queue 2
+			 BOOST_CHECK(queues.steal(2) == stolen_from_1);
+			 BOOST_CHECK(!queues.steal(2));
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that draining the queues returns all left-over items
+			 GLocalWorkQueuesT<GSimpleContainer> queues(2);
+
+			 std::vector<item_ptr_type> chunk;
+			 for(std::size_t i = 0; i < 4; i++) chunk.push_back(std::make_shared<GSimpleContainer>(i));
+			 queues.distribute(1, chunk);
+
+			 auto left_overs = queues.drain();
+			 BOOST_CHECK(left_overs.size() == 3);
+			 BOOST_CHECK(queues.empty(0));
+			 BOOST_CHECK(queues.empty(1));
+			 BOOST_CHECK(queues.drain().empty());
+
+			 queues.reset(0);
+			 BOOST_CHECK(queues.size() == 0);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that batches of items are returned to their buffer ports
+			 GBrokerT<GSimpleContainer> broker;
+			 auto port_ptr = std::make_shared<GBufferPortT<GSimpleContainer>>();
+			 broker.enrol_buffer_port(port_ptr);
+
+			 std::vector<item_ptr_type> batch;
+			 for(std::size_t i = 0; i < 4; i++) {
+				 batch.push_back(std::make_shared<GSimpleContainer>(i));
+				 batch.back()->setBufferId(port_ptr->getUniqueTag());
+			 }
+
+			 // An item whose buffer port does not exist is discarded
+			 auto orphan_ptr = std::make_shared<GSimpleContainer>(4);
+			 orphan_ptr->setBufferId(port_ptr->getUniqueTag() + 1);
+			 batch.push_back(orphan_ptr);
+
+			 std::chrono::milliseconds timeout(10);
+			 BOOST_CHECK(broker.put_n(batch, timeout) == 4);
+			 BOOST_CHECK(batch.empty());
+
+			 item_ptr_type p;
+			 for(std::size_t i = 0; i < 4; i++) {
+				 BOOST_CHECK(port_ptr->pop_processed(p, timeout));
+			 }
+			 BOOST_CHECK(!port_ptr->pop_processed(p, timeout));
+
+			 // Unprocessed items are handed back to the raw queue
+			 std::vector<item_ptr_type> unprocessed;
+			 for(std::size_t i = 0; i < 2; i++) {
+				 unprocessed.push_back(std::make_shared<GSimpleContainer>(i));
+				 unprocessed.back()->setBufferId(port_ptr->getUniqueTag());
+			 }
+			 BOOST_CHECK(broker.put_raw_n(unprocessed, timeout) == 2);
+			 BOOST_CHECK(unprocessed.empty());
+
+			 std::vector<item_ptr_type> chunk;
+			 BOOST_CHECK(broker.get_n(chunk, 10, timeout) == 2);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that items that could not be submitted in time are kept for a retry
+			 GBrokerT<GSimpleContainer> broker;
+			 auto port_ptr = std::make_shared<GBufferPortT<GSimpleContainer>>(2);
+			 broker.enrol_buffer_port(port_ptr);
+
+			 std::chrono::milliseconds timeout(1);
+
+			 std::vector<item_ptr_type> unprocessed;
+			 for(std::size_t i = 0; i < 3; i++) {
+				 unprocessed.push_back(std::make_shared<GSimpleContainer>(i));
+				 unprocessed.back()->setBufferId(port_ptr->getUniqueTag());
+			 }
+			 auto last_ptr = unprocessed.back();
+
+			 // There is only room for two items in the raw queue
+			 BOOST_CHECK(broker.put_raw_n(unprocessed, timeout) == 2);
+			 BOOST_CHECK(unprocessed.size() == 1);
+			 BOOST_CHECK(unprocessed.front() == last_ptr);
+
+			 // Once a consumer has retrieved an item, the retry succeeds
+			 item_ptr_type p;
+			 BOOST_CHECK(port_ptr->pop_raw(p, timeout));
+			 BOOST_CHECK(broker.put_raw_n(unprocessed, timeout) == 1);
+			 BOOST_CHECK(unprocessed.empty());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that items pushed back into the raw queue do not count as retrievals
+			 GBrokerT<GSimpleContainer> broker;
+			 auto port_ptr = std::make_shared<GBufferPortT<GSimpleContainer>>();
+			 broker.enrol_buffer_port(port_ptr);
+
+			 std::chrono::milliseconds timeout(1);
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 0);
+
+			 std::vector<item_ptr_type> unprocessed;
+			 for(std::size_t i = 0; i < 3; i++) {
+				 unprocessed.push_back(std::make_shared<GSimpleContainer>(i));
+				 unprocessed.back()->setBufferId(port_ptr->getUniqueTag());
+			 }
+			 BOOST_CHECK(broker.put_raw_n(unprocessed, timeout) == 3);
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 0);
+
+			 item_ptr_type p;
+			 BOOST_CHECK(port_ptr->pop_raw(p, timeout));
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 1);
+			 auto first_ptr = p;
+
+			 std::vector<item_ptr_type> chunk;
+			 BOOST_CHECK(port_ptr->pop_raw_n(chunk, 10, timeout) == 2);
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 3);
+
+			 // A failed retrieval is not counted
+			 BOOST_CHECK(!port_ptr->pop_raw(p, timeout));
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 3);
+
+			 // Pushing the items back leaves the count unchanged
+			 chunk.push_back(first_ptr);
+			 BOOST_CHECK(broker.put_raw_n(chunk, timeout) == 3);
+			 BOOST_CHECK(port_ptr->getNRawRetrievals() == 3);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that all items return processed when fetched in chunks and stolen by siblings
+			 std::shared_ptr<GStdThreadConsumerT<GSimpleContainer>> consumer_ptr(new GStdThreadConsumerT<GSimpleContainer>(4));
+			 consumer_ptr->setChunkSize(8);
+			 consumer_ptr->setMaxBatchAge(std::chrono::milliseconds(10));
+			 GBROKER(GSimpleContainer)->enrol_consumer(consumer_ptr);
+
+			 GBrokerExecutorT<GSimpleContainer> executor;
+			 executor.init();
+
+			 for(std::size_t iteration = 0; iteration < 5; iteration++) {
+				 std::vector<item_ptr_type> workItems;
+				 for(std::size_t i = 0; i < 100; i++) {
+					 workItems.push_back(std::make_shared<GSimpleContainer>(i));
+					 workItems.back()->mark_as_due_for_processing();
+				 }
+
+				 auto status = executor.workOn(workItems);
+				 BOOST_CHECK(status.is_complete);
+				 BOOST_CHECK(!status.has_errors);
+				 BOOST_CHECK(workItems.size() == 100);
+				 for(auto const& item_ptr: workItems) {
+					 BOOST_CHECK(item_ptr->is_processed());
+				 }
+			 }
+
+			 // Processed items are returned right after their own evaluation, even
+			 // when later items of the same chunk take much longer than the maximum batch age
+			 const std::chrono::milliseconds evaluation(200);
+			 std::vector<item_ptr_type> slowItems;
+			 for(std::size_t i = 0; i < 16; i++) {
+				 slowItems.push_back(item_ptr_type(new GSlowContainer(i, evaluation)));
+				 slowItems.back()->mark_as_due_for_processing();
+			 }
+
+			 auto status = executor.workOn(slowItems);
+			 BOOST_CHECK(status.is_complete);
+			 BOOST_REQUIRE(slowItems.size() == 16);
+			 for(auto const& item_ptr: slowItems) {
+				 auto slow_ptr = std::dynamic_pointer_cast<GSlowContainer>(item_ptr);
+				 BOOST_REQUIRE(slow_ptr);
+				 BOOST_CHECK(slow_ptr->getProcSubmissionTime() - slow_ptr->getProcessingEndTime() < evaluation/2);
+			 }
+
+			 executor.finalize();
+			 GBROKER(GSimpleContainer)->finalize();
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test features that are expected to fail
+	  */
+	 void failures_expected() {
+		 { // Accessing a queue that does not exist
+			 GLocalWorkQueuesT<GSimpleContainer> queues(2);
+			 BOOST_CHECK_THROW(queues.pop(2), std::out_of_range);
+			 BOOST_CHECK_THROW(queues.empty(2), std::out_of_range);
+		 }
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Courtier */
+} /* namespace Gem */
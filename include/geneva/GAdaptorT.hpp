@@ -41,6 +41,7 @@
 
 // Standard headers go here
 #include <type_traits>
+#include <cmath>
 
 // Boost headers go here
 
@@ -48,6 +49,7 @@
 
 #include "common/GSerializationHelperFunctionsT.hpp"
 #include "hap/GRandomT.hpp"
+#include "hap/GZigguratNormalT.hpp"
 #include "geneva/GObject.hpp"
 #include "geneva/GOptimizationEnums.hpp"
 
@@ -514,6 +516,17 @@ public:
 		 return std::tuple<fp_type, fp_type>{m_minAdProb, m_maxAdProb};
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Indicates whether collections of bits should be adapted as a whole, drawing
+	  * the bits to be flipped a word at a time. The adaption probability is then
+	  * self-adapted once per collection instead of once per bit. Only adaptors whose
+	  * customAdaptions() does nothing but invert a boolean value may return true.
+	  */
+	 virtual bool adaptsBitsWordWise() const BASE {
+		 return false;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Common interface for all adaptors to the adaption functionality. The user
@@ -539,7 +552,7 @@ public:
 			 m_adProb *= gexp(
 				 m_normal_distribution(
 					 gr
-					 , typename std::normal_distribution<fp_type>::param_type(
+					 , typename Gem::Hap::ziggurat_normal_distribution<fp_type>::param_type(
 						 0.
 						 , m_adaptAdProb
 					 ))
@@ -604,6 +617,13 @@ public:
 	  * might be more severe, so we have implemented repeated adaption of mutation parameters
 	  * in this function.
 	  *
+	  * For small adaption probabilities, drawing a boolean random number for every
+	  * position is wasteful. The gaps between adapted positions of a sequence of
+	  * Bernoulli trials with probability p follow a geometric distribution with the
+	  * same p, so we then jump from one adapted position to the next instead. The
+	  * statistics are identical, while the cost is proportional to the number of
+	  * adaptions rather than the size of the collection.
+	  *
 	  * @param valVec A vector of values that need to be adapted
 	  * @param range A typical value range for type T
 	  * @return The number of adaptions that were carried out
@@ -623,7 +643,7 @@ public:
 			 m_adProb *= gexp(
 				 m_normal_distribution(
 					 gr
-					 , typename std::normal_distribution<fp_type>::param_type(
+					 , typename Gem::Hap::ziggurat_normal_distribution<fp_type>::param_type(
 						 0.
 						 , m_adaptAdProb
 					 ))
@@ -637,17 +657,40 @@ public:
 		 }
 
 		 if (adaptionMode::WITHPROBABILITY == m_adaptionMode) { // The most likely case
-			 for (auto &val: valVec) {
-				 // A likelihood of m_adProb for adaption
-				 if (m_weighted_bool(gr, std::bernoulli_distribution::param_type(gfabs(m_adProb)))) {
+			 fp_type adProb = gfabs(m_adProb);
+
+			 if (adProb > fp_type(0.) && adProb < fp_type(SKIPSAMPLINGMAXADPROB)) {
+				 // Jump from one adapted position to the next. The number of positions
+				 // skipped in-between follows a geometric distribution. The gap is
+				 // compared with the remaining positions before it is added, as it
+				 // may be huge for tiny probabilities (where log1p(-adProb) rounds to 0)
+				 typename std::geometric_distribution<std::size_t>::param_type gap(adProb);
+				 std::size_t pos = 0, skip = 0;
+				 while ((skip = m_geometric_gap(gr, gap)) < valVec.size() - pos) {
+					 pos += skip;
 					 adaptAdaption(range, gr);
 					 customAdaptions(
-						 val
+						 valVec[pos]
 						 , range
 						 , gr
 					 );
 
 					 nAdapted += 1;
+					 pos += 1;
+				 }
+			 } else {
+				 for (auto &val: valVec) {
+					 // A likelihood of m_adProb for adaption
+					 if (m_weighted_bool(gr, std::bernoulli_distribution::param_type(adProb))) {
+						 adaptAdaption(range, gr);
+						 customAdaptions(
+							 val
+							 , range
+							 , gr
+						 );
+
+						 nAdapted += 1;
+					 }
 				 }
 			 }
 		 } else if (adaptionMode::ALWAYS == m_adaptionMode) { // always adapt
@@ -1077,6 +1120,46 @@ protected:
 
         //------------------------------------------------------------------------------
 
+        { // Check that the adaption of collections adapts the expected share of positions
+            std::shared_ptr<GAdaptorT<T, fp_type>> p_test = this->clone<GAdaptorT<T, fp_type>>();
+
+            p_test->setAdaptionMode(adaptionMode::WITHPROBABILITY);
+            // Prevent changes to m_adProb
+            p_test->setAdaptAdProb(0.);
+            p_test->setAdProbRange(
+                    0.
+                    , 1.
+            );
+
+            const std::size_t nPositions = 100000;
+            std::vector<T> testVec(nPositions, T(0));
+
+            // Covers both gap sampling (small probabilities) and per-position trials
+            for (fp_type prob: {fp_type(0.001), fp_type(0.01), fp_type(0.1), fp_type(0.5)}) {
+                p_test->setAdaptionProbability(prob);
+
+                std::size_t nAdapted = p_test->adapt(
+                        testVec
+                        , T(1)
+                        , gr
+                );
+
+                // nAdapted follows a binomial distribution. Allow for 5 standard deviations
+                double expected = double(nPositions) * double(prob);
+                double sigma = std::sqrt(expected * (1. - double(prob)));
+
+                BOOST_CHECK_MESSAGE(
+                        std::fabs(double(nAdapted) - expected) < 5. * sigma
+                , "\n"
+                                << "nAdapted = " << nAdapted << "\n"
+                                << "prob = " << prob << "\n"
+                                << "with allowed window = [" << expected - 5. * sigma << " : " << expected + 5. * sigma << "]" << "\n"
+                );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         { // Check setting and retrieval of the adaption mode
             std::shared_ptr<GAdaptorT<T, fp_type>> p_test = this->clone<GAdaptorT<T, fp_type>>();
 
@@ -1374,9 +1457,10 @@ protected:
 	 /***************************************************************************/
 	 // Protected data
 
-	 std::normal_distribution<fp_type> m_normal_distribution; ///< Helps with gauss-type mutation
+	 Gem::Hap::ziggurat_normal_distribution<fp_type> m_normal_distribution; ///< Helps with gauss-type mutation
 	 std::uniform_real_distribution<fp_type> m_uniform_real_distribution; ///< Access to uniformly distributed floating point random numbers
 	 std::bernoulli_distribution m_weighted_bool; ///< Access to boolean random numbers with a given probability structure
+	 std::geometric_distribution<std::size_t> m_geometric_gap; ///< Access to the gaps between adapted positions of a collection
 
 private:
 	/***************************************************************************/
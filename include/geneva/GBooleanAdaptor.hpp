@@ -42,6 +42,7 @@
 // Standard headers go here
 
 // Boost headers go here
+#include <boost/serialization/version.hpp>
 
 // Geneva headers go here
 #include "common/GExceptions.hpp"
@@ -69,13 +70,18 @@ class GBooleanAdaptor
     friend class boost::serialization::access;
 
     template<typename Archive>
-    void serialize(Archive &ar, const unsigned int) {
+    void serialize(Archive &ar, const unsigned int version) {
         using boost::serialization::make_nvp;
 
         ar
         & make_nvp(
             "GAdaptorT_bool"
             , boost::serialization::base_object<GAdaptorT<bool>>(*this));
+
+        // Version 0 archives predate word-wise adaption
+        if(version > 0) {
+            ar & BOOST_SERIALIZATION_NVP(m_adaptBitsWordWise);
+        }
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -94,6 +100,11 @@ public:
     /** @brief Random initialization of the adaptor */
     G_API_GENEVA bool randomInit(Gem::Hap::GRandomBase &) override;
 
+    /** @brief Determines whether collections of bits are adapted as a whole, a word at a time */
+    G_API_GENEVA void setAdaptBitsWordWise(bool);
+    /** @brief Indicates whether collections of bits are adapted as a whole, a word at a time */
+    G_API_GENEVA bool adaptsBitsWordWise() const override;
+
 protected:
     /** @brief Loads the data of another GObject */
     G_API_GENEVA void load_(const GObject *) override;
@@ -133,6 +144,9 @@ private:
     G_API_GENEVA std::string name_() const override;
     /** @brief Creates a deep clone of this object. */
     G_API_GENEVA GObject *clone_() const override;
+
+    /** @brief Whether collections of bits are adapted as a whole, with adProb self-adapted once per collection */
+    bool m_adaptBitsWordWise = false;
 };
 
 /******************************************************************************/
@@ -141,4 +155,5 @@ private:
 } /* namespace Gem */
 
 BOOST_CLASS_EXPORT_KEY(Gem::Geneva::GBooleanAdaptor)
+BOOST_CLASS_VERSION(Gem::Geneva::GBooleanAdaptor, 1)
 
@@ -41,11 +41,13 @@
 
 // Standard headers go here
 #include <random>
+#include <cstdint>
 
 // Boost headers go here
 
 // Geneva headers go here
 #include "common/GExceptions.hpp"
+#include "common/GCommonHelperFunctions.hpp"
 #include "common/GCommonMathHelperFunctionsT.hpp"
 #include "geneva/GOptimizationEnums.hpp"
 #include "geneva/GParameterCollectionT.hpp"
@@ -158,6 +160,9 @@ protected:
 	 G_API_GENEVA void specificTestsFailuresExpected_GUnitTests_() override;
 
 private:
+	 /** @brief Assigns random values to all bits of the collection, drawing 64 bits at a time */
+	 G_API_GENEVA void fillRandomBits(const double&, Gem::Hap::GRandomBase&);
+
 	 /** @brief Emits a name for this class / object */
 	 G_API_GENEVA std::string name_() const override;
 	 /** @brief Creates a deep copy of this object */
@@ -41,6 +41,7 @@
 
 // Standard header files go here
 #include <string>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -178,36 +179,63 @@ public:
         fp_type lowerBoundary = GConstrainedNumCollectionT<fp_type>::getLowerBoundary();
         fp_type upperBoundary = GConstrainedNumCollectionT<fp_type>::getUpperBoundary();
 
-        if (val >= lowerBoundary && val < upperBoundary) {
-            return val;
-        } else {
-            // Find out which region the value is in (compare figure transferFunction.pdf
-            // that should have been delivered with this software). Note that boost::numeric_cast<>
-            // may throw - exceptions must be caught in surrounding functions.
-            std::int32_t region = 0;
-
-#ifdef DEBUG
-            region = boost::numeric_cast<std::int32_t>(
-                Gem::Common::gfloor(
-                    (fp_type(val) - fp_type(lowerBoundary)) / (fp_type(upperBoundary) - fp_type(lowerBoundary))));
-#else
-            region =	static_cast<std::int32_t>(Gem::Common::gfloor((fp_type(val) - fp_type(lowerBoundary)) / (fp_type(upperBoundary) - fp_type(lowerBoundary))));
-#endif
-
-            // Check whether we are in an odd or an even range and calculate the
-            // external value accordingly
-            fp_type mapping = fp_type(0.);
-            if (region % 2 == 0) { // can it be divided by 2 ? Region 0,2,... or a negative even range
-                mapping = val - fp_type(region) * (upperBoundary - lowerBoundary);
-            } else { // Range 1,3,... or a negative odd range
-                mapping = -val + (fp_type(region - 1) * (upperBoundary - lowerBoundary) + 2 * upperBoundary);
-            }
-
-            return mapping;
+        return reflect(val, lowerBoundary, upperBoundary, upperBoundary - lowerBoundary);
+    }
+
+    /****************************************************************************/
+    /**
+     * Applies the transfer function to n values in one go. The reflection is
+     * computed without branches, so the compiler may vectorize the loop. As
+     * transfer() uses the same arithmetic, results are identical.
+     *
+     * @param in The values to which the transformation should be applied
+     * @param out The target of the transformed values (may be identical to in)
+     * @param n The number of values to be transformed
+     */
+    void transferBatch(
+        const fp_type *in
+        , fp_type *out
+        , std::size_t n
+    ) const override {
+        const fp_type lowerBoundary = GConstrainedNumCollectionT<fp_type>::getLowerBoundary();
+        const fp_type upperBoundary = GConstrainedNumCollectionT<fp_type>::getUpperBoundary();
+        const fp_type width = upperBoundary - lowerBoundary;
+
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = reflect(in[i], lowerBoundary, upperBoundary, width);
         }
+    }
 
-        // Make the compiler happy
-        return fp_type(0.);
+private:
+    /****************************************************************************/
+    /**
+     * Maps a value into the range [lowerBoundary, upperBoundary[ (compare figure
+     * transferFunction.pdf that should have been delivered with this software).
+     * The region of the value is kept as a floating point number, so that it
+     * cannot overflow for values far outside of the boundaries. Values inside
+     * of the boundaries are returned unchanged. The function has no branches,
+     * so that loops over it may be vectorized.
+     *
+     * @param val The value to which the transformation should be applied
+     * @param lowerBoundary The lower boundary of the value range
+     * @param upperBoundary The (open) upper boundary of the value range
+     * @param width The difference between upper and lower boundary
+     * @return The transformed value
+     */
+    static fp_type reflect(
+        fp_type val
+        , fp_type lowerBoundary
+        , fp_type upperBoundary
+        , fp_type width
+    ) {
+        const fp_type region = std::floor((val - lowerBoundary) / width);
+        const fp_type isOdd = region - fp_type(2.) * std::floor(region * fp_type(0.5));
+
+        const fp_type evenMapping = val - region * width; // Region 0,2,... or a negative even region
+        const fp_type oddMapping = -val + ((region - fp_type(1.)) * width + fp_type(2.) * upperBoundary); // Region 1,3,... or a negative odd region
+        const fp_type mapping = (isOdd != fp_type(0.)) ? oddMapping : evenMapping;
+
+        return (val >= lowerBoundary && val < upperBoundary) ? val : mapping;
     }
 
 protected:
@@ -357,6 +357,39 @@ public:
      * value. Declared public so we can do tests of the value transformation. */
     virtual num_type transfer(const num_type &) const BASE = 0;
 
+    /***************************************************************************/
+    /**
+     * Applies the transfer function to n values in one go. Derived classes may
+     * replace this element-wise loop by a more efficient kernel.
+     *
+     * @param in The values to which the transformation should be applied
+     * @param out The target of the transformed values (may be identical to in)
+     * @param n The number of values to be transformed
+     */
+    virtual void transferBatch(
+        const num_type *in
+        , num_type *out
+        , std::size_t n
+    ) const BASE {
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = transfer(in[i]);
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * Appends the externally visible values of all positions to a vector
+     *
+     * @param vals The vector to which the transformed values should be appended
+     */
+    void appendTransferredValues(std::vector<num_type> &vals) const {
+        std::size_t offset = vals.size();
+        vals.resize(offset + this->size());
+        if (not this->empty()) {
+            this->transferBatch(&(*this->begin()), vals.data() + offset, this->size());
+        }
+    }
+
     /***************************************************************************/
     /**
      * Converts the local data to a boost::property_tree node
@@ -398,13 +431,13 @@ public:
             baseName + ".nVals"
             , this->size());
 
-        typename GConstrainedNumCollectionT<num_type>::const_iterator cit;
-        std::size_t pos;
-        for (cit = this->begin(); cit != this->end(); ++cit) {
-            pos = cit - this->begin();
+        // Emit the externally visible values
+        std::vector<num_type> vals;
+        this->appendTransferredValues(vals);
+        for (std::size_t pos = 0; pos < vals.size(); pos++) {
             ptr.put(
                 baseName + "values.value" + Gem::Common::to_string(pos)
-                , *cit
+                , vals[pos]
             );
         }
         ptr.put(
@@ -448,6 +481,25 @@ protected:
         m_upperBoundary = p_load->m_upperBoundary;
     }
 
+    /***************************************************************************/
+    /**
+     * Loads the data of another object of identical type and structure
+     * (see GParameterBase::loadValues())
+     *
+     * @param cp Another object of identical type and structure
+     */
+    void loadValues_(const GParameterBase &cp) override {
+        // Identical types are guaranteed by GParameterBase::loadValues()
+        const GConstrainedNumCollectionT<num_type>& p_load = static_cast<const GConstrainedNumCollectionT<num_type>&>(cp);
+
+        // Load our parent class'es data ...
+        GParameterCollectionT<num_type>::loadValues_(cp);
+
+        // ... and then our local data
+        m_lowerBoundary = p_load.m_lowerBoundary;
+        m_upperBoundary = p_load.m_upperBoundary;
+    }
+
     /***************************************************************************/
     /** @brief Allow access to this classes compare_ function */
     friend void Gem::Common::compare_base_t<GConstrainedNumCollectionT<num_type>>(
@@ -468,6 +468,25 @@ protected:
 		 upperBoundary_ = p_load->upperBoundary_;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Loads the data of another object of identical type and structure
+	  * (see GParameterBase::loadValues())
+	  *
+	  * @param cp Another object of identical type and structure
+	  */
+	 void loadValues_(const GParameterBase& cp) override {
+		 // Identical types are guaranteed by GParameterBase::loadValues()
+		 const GConstrainedNumT<T>& p_load = static_cast<const GConstrainedNumT<T>&>(cp);
+
+		 // Load our parent class'es data ...
+		 GParameterT<T>::loadValues_(cp);
+
+		 // ... and then our own
+		 lowerBoundary_ = p_load.lowerBoundary_;
+		 upperBoundary_ = p_load.upperBoundary_;
+	 }
+
 	/***************************************************************************/
 	/** @brief Allow access to this classes compare_ function */
 	friend void Gem::Common::compare_base_t<GConstrainedNumT<T>>(
@@ -254,12 +254,12 @@ protected:
         // adapt the value in situ. Note that this changes
         // the argument of this function
         value += (
-            range * GAdaptorT<fp_type, fp_type>::m_normal_distribution(
+            range * static_cast<fp_type>(GAdaptorT<fp_type>::m_normal_distribution(
                 gr
-                , typename std::normal_distribution<fp_type>::param_type(
+                , Gem::Hap::ziggurat_normal_distribution<double>::param_type(
                     0.
                     , GNumGaussAdaptorT<fp_type, fp_type>::sigma_
-                )));
+                ))));
     }
 
     /* ----------------------------------------------------------------------------------
@@ -0,0 +1,145 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+
+// Boost headers go here
+
+// Geneva headers go here
+#include "geneva/GFPGaussAdaptorT.hpp"
+
+namespace Gem {
+namespace Geneva {
+
+/******************************************************************************/
+/**
+ * The GFloatGaussAdaptor represents an adaptor used for the adaption of
+ * float values through the addition of gaussian-distributed random numbers.
+ * See the documentation of GNumGaussAdaptorT<T> for further information on adaptors
+ * in the Geneva context. This class is at the core of evolutionary strategies,
+ * as implemented by this library. It is now implemented through a generic
+ * base class that can also be used to adapt other numeric types.
+ */
+class GFloatGaussAdaptor
+    :
+        public GFPGaussAdaptorT<float>
+{
+    ///////////////////////////////////////////////////////////////////////
+    friend class boost::serialization::access;
+
+    template<typename Archive>
+    void serialize(Archive &ar, const unsigned int) {
+        using boost::serialization::make_nvp;
+
+        ar
+        & make_nvp(
+            "GFPGaussAdaptorT_float"
+            , boost::serialization::base_object<GFPGaussAdaptorT<float>>(*this));
+    }
+    ///////////////////////////////////////////////////////////////////////
+
+public:
+    /** @brief The default constructor */
+    G_API_GENEVA GFloatGaussAdaptor() = default;
+    /** @brief The copy constructor */
+    G_API_GENEVA GFloatGaussAdaptor(const GFloatGaussAdaptor &) = default;
+
+    /** @brief Initialization with a adaption probability */
+    explicit G_API_GENEVA GFloatGaussAdaptor(const double &);
+    /** @brief Initialization with a number of values belonging to the width of the gaussian */
+    G_API_GENEVA GFloatGaussAdaptor(
+        const float &
+        , const float &
+        , const float &
+        , const float &
+    );
+    /** @brief Initialization with a number of values belonging to the width of the gaussian and the adaption probability */
+    G_API_GENEVA GFloatGaussAdaptor(
+        const float &
+        , const float &
+        , const float &
+        , const float &
+        , const double &
+    );
+
+    /** @brief The destructor */
+    G_API_GENEVA ~GFloatGaussAdaptor() override = default;
+
+protected:
+    /** @brief Loads the data of another GObject */
+    G_API_GENEVA void load_(const GObject *) override;
+
+    /** @brief Allow access to this classes compare_ function */
+    friend void Gem::Common::compare_base_t<GFloatGaussAdaptor>(
+        GFloatGaussAdaptor const &
+        , GFloatGaussAdaptor const &
+        , Gem::Common::GToken &
+    );
+
+    /** @brief Searches for compliance with expectations with respect to another object of the same type */
+    G_API_GENEVA void compare_(
+        const GObject & // the other object
+        , const Gem::Common::expectation & // the expectation for this object, e.g. equality
+        , const double & // the limit for allowed deviations of floating point types
+    ) const override;
+
+    /** @brief Applies modifications to this object. This is needed for testing purposes */
+    G_API_GENEVA bool modify_GUnitTests_() override;
+    /** @brief Performs self tests that are expected to succeed. This is needed for testing purposes */
+    G_API_GENEVA void specificTestsNoFailureExpected_GUnitTests_() override;
+    /** @brief Performs self tests that are expected to fail. This is needed for testing purposes */
+    G_API_GENEVA void specificTestsFailuresExpected_GUnitTests_() override;
+
+    /** @brief Retrieves the id of this adaptor */
+    G_API_GENEVA Gem::Geneva::adaptorId getAdaptorId_() const override;
+    /** @brief Emits a name for this class / object */
+    G_API_GENEVA std::string name_() const override;
+    /** @brief Creates a deep clone of this object. */
+    G_API_GENEVA GObject *clone_() const override;
+};
+
+/******************************************************************************/
+
+} /* namespace Geneva */
+} /* namespace Gem */
+
+BOOST_CLASS_EXPORT_KEY(Gem::Geneva::GFloatGaussAdaptor)
+
@@ -227,7 +227,7 @@ protected:
 			 static_cast<double>(range)
 			 * GAdaptorT<int_type, double>::m_normal_distribution(
 				 gr
-				 , std::normal_distribution<double>::param_type(0., this->getSigma())
+				 , Gem::Hap::ziggurat_normal_distribution<double>::param_type(0., this->getSigma())
 			 )
 		 );
 
@@ -41,8 +41,11 @@
 
 // Standard header files go here
 #include <type_traits>
+#include <numeric>
+#include <algorithm>
 
 // Boost header files go here
+#include <boost/serialization/version.hpp>
 
 // Geneva header files go here
 #include "common/GCommonMathHelperFunctions.hpp"
@@ -71,11 +74,18 @@ class GPreEvaluationValidityCheckT :
     friend class boost::serialization::access;
 
     template<typename Archive>
-    void serialize(Archive &ar, const unsigned int) {
+    void serialize(Archive &ar, const unsigned int version) {
         using boost::serialization::make_nvp;
         ar
         & BOOST_SERIALIZATION_BASE_OBJECT_NVP(GObject)
         & BOOST_SERIALIZATION_NVP(allowNegative_);
+
+        // The cost was added in version 1
+        if (version > 0) {
+            ar & BOOST_SERIALIZATION_NVP(cost_);
+        } else {
+            cost_ = DEFAULTVALIDITYCHECKCOST;
+        }
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -196,6 +206,26 @@ public:
         allowNegative_ = allowNegative;
     }
 
+    /***************************************************************************/
+    /**
+     * Allows to declare the relative cost of this check. Cheap checks are
+     * evaluated first by GCheckCombinerT. Only the declared cost is used, so
+     * that the evaluation order, and with it the result of the FIRSTINVALID
+     * policy, is reproducible. Checks without a declared cost have a cost of
+     * DEFAULTVALIDITYCHECKCOST.
+     */
+    void setCost(double cost) {
+        cost_ = cost;
+    }
+
+    /***************************************************************************/
+    /**
+     * Retrieves the declared cost of this check
+     */
+    double getCost() const {
+        return cost_;
+    }
+
 protected:
     /***************************************************************************/
     /**
@@ -236,6 +266,7 @@ protected:
 
         // ... and then our local data
         allowNegative_ = p_load->allowNegative_;
+        cost_ = p_load->cost_;
     }
 
     /***************************************************************************/
@@ -287,6 +318,11 @@ protected:
                      , p_load->allowNegative_)
             , token
         );
+        compare_t(
+            IDENTITY(cost_
+                     , p_load->cost_)
+            , token
+        );
 
         // React on deviations from the expectation
         token.evaluate();
@@ -300,6 +336,7 @@ private:
     /***************************************************************************/
 
     bool allowNegative_ = false; ///< Set to true if negative values are considered to be valid
+    double cost_ = DEFAULTVALIDITYCHECKCOST; ///< The user-declared relative cost of this check
 };
 
 /******************************************************************************/
@@ -565,30 +602,66 @@ public:
 protected:
     /***************************************************************************/
     /**
-     * Combines all parameters according to a user-defined policy. Note that we
-     * DO have to take care here of a situation where the invalidity equals
-     * MIN- or MAX_DOUBLE.
+     * Combines all parameters according to a user-defined policy. Checks are
+     * evaluated in the order of their declared cost, and in the order of
+     * registration for identical costs, so that evaluation may stop early
+     * when the result is already determined. Note that we DO have to take care
+     * here of a situation where the invalidity equals MIN- or MAX_DOUBLE.
      */
     double check_(const ind_type *cp) const override {
-        // First identify invalid checks
-        std::vector<double> invalidChecks;
+        const std::vector<std::shared_ptr<GPreEvaluationValidityCheckT<ind_type>>> &validityChecks = GValidityCheckContainerT<ind_type>::validityChecks_;
+
+        // Evaluate cheap checks first
+        std::vector<std::size_t> evaluationOrder(validityChecks.size());
+        std::iota(evaluationOrder.begin(), evaluationOrder.end(), std::size_t(0));
+        std::stable_sort(
+            evaluationOrder.begin()
+            , evaluationOrder.end()
+            , [&validityChecks](std::size_t x, std::size_t y) -> bool {
+                return validityChecks[x]->getCost() < validityChecks[y]->getCost();
+            }
+        );
+
+        // Identify invalid checks. Invalidities are stored in the order of registration,
+        // so that the combined result does not depend on the evaluation order
+        std::vector<double> invalidities(validityChecks.size(), 0.);
+        bool invalidChecksFound = false;
         double validityLevel;
-        typename std::vector<std::shared_ptr<GPreEvaluationValidityCheckT<ind_type>>>::const_iterator cit;
-        for (cit = GValidityCheckContainerT<ind_type>::validityChecks_.begin();
-             cit != GValidityCheckContainerT<ind_type>::validityChecks_.end(); ++cit) {
-            if (not(*cit)->isValid(
+        for (auto pos: evaluationOrder) {
+            if (not validityChecks[pos]->isValid(
                 cp
                 , validityLevel
             )) {
-                invalidChecks.push_back(validityLevel);
+                // An invalidity at the numeric boundaries determines the result for all policies
+                if (boost::numeric::bounds<double>::highest() == validityLevel ||
+                    boost::numeric::bounds<double>::lowest() == validityLevel) {
+                    return boost::numeric::bounds<double>::highest();
+                }
+
+                // No need to look at further checks if we only want to know about the first invalid one
+                if (Gem::Geneva::validityCheckCombinerPolicy::FIRSTINVALID == combinerPolicy_) {
+                    return validityLevel;
+                }
+
+                invalidities[pos] = validityLevel;
+                invalidChecksFound = true;
             }
         }
 
         // We can leave now, if no invalid checks were found
-        if (invalidChecks.empty()) { // All checks were valid
+        if (not invalidChecksFound) { // All checks were valid
             return 0.;
         }
 
+        // Invalid checks always have a validity level > 1, valid ones 0
+        std::vector<double> invalidChecks;
+        std::copy_if(
+            invalidities.begin()
+            , invalidities.end()
+            , std::back_inserter(invalidChecks)
+            , [](double v) -> bool { return v > 0.; }
+        );
+
         // Now act on the invalid tests
         switch (combinerPolicy_) {
             // --------------------------------------------------------------------
@@ -771,4 +844,18 @@ struct is_abstract<const Gem::Geneva::GValidityCheckContainerT<ind_type>> :
 }
 
 /******************************************************************************/
+// The version of GPreEvaluationValidityCheckT<>. This is the content of BOOST_CLASS_VERSION(T, 1)
+
+namespace boost {
+namespace serialization {
+template<typename ind_type>
+struct version<Gem::Geneva::GPreEvaluationValidityCheckT<ind_type>> {
+	typedef mpl::int_<1> type;
+	typedef mpl::integral_c_tag tag;
+	BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+}
+}
+
+/******************************************************************************/
 
@@ -818,19 +818,19 @@ protected:
         sigma1_ *= gexp(
             GAdaptorT<num_type>::m_normal_distribution(
                 gr
-                , typename std::normal_distribution<fp_type>::param_type(
+                , typename Gem::Hap::ziggurat_normal_distribution<fp_type>::param_type(
                     0.
                     , gfabs(sigmaSigma1_))));
         sigma2_ *= gexp(
             GAdaptorT<num_type>::m_normal_distribution(
                 gr
-                , typename std::normal_distribution<fp_type>::param_type(
+                , typename Gem::Hap::ziggurat_normal_distribution<fp_type>::param_type(
                     0.
                     , gfabs(sigmaSigma2_))));
         delta_ *= gexp(
             GAdaptorT<num_type>::m_normal_distribution(
                 gr
-                , typename std::normal_distribution<fp_type>::param_type(
+                , typename Gem::Hap::ziggurat_normal_distribution<fp_type>::param_type(
                     0.
                     , gfabs(sigmaDelta_))));
 
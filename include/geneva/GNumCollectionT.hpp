@@ -322,6 +322,25 @@ protected:
         upperInitBoundary_ = p_load->upperInitBoundary_;
     }
 
+    /***************************************************************************/
+    /**
+     * Loads the data of another object of identical type and structure
+     * (see GParameterBase::loadValues())
+     *
+     * @param cp Another object of identical type and structure
+     */
+    void loadValues_(const GParameterBase &cp) override {
+        // Identical types are guaranteed by GParameterBase::loadValues()
+        const GNumCollectionT<num_type>& p_load = static_cast<const GNumCollectionT<num_type>&>(cp);
+
+        // Load our parent class'es data ...
+        GParameterCollectionT<num_type>::loadValues_(cp);
+
+        // ... and then our local data
+        lowerInitBoundary_ = p_load.lowerInitBoundary_;
+        upperInitBoundary_ = p_load.upperInitBoundary_;
+    }
+
     /***************************************************************************/
     /** @brief Allow access to this classes compare_ function */
     friend void Gem::Common::compare_base_t<GNumCollectionT<num_type>>(
@@ -55,11 +55,13 @@ namespace Geneva {
  * GNumGaussAdaptorT represents an adaptor used for the adaption of numeric
  * types, by the addition of gaussian-distributed random numbers. Different numeric
  * types may be used, including Boost's integer representations.
- * The type used needs to be specified as a template parameter.
+ * The type used needs to be specified as a template parameter. fp_type is the
+ * type used for sigma and related calculations, while adaption probabilities
+ * are always handled in double precision by GAdaptorT<num_type>.
  */
 template<typename num_type, typename fp_type>
 class GNumGaussAdaptorT
-	: public GAdaptorT<num_type, fp_type>
+	: public GAdaptorT<num_type>
 {
 	 ///////////////////////////////////////////////////////////////////////
 	 friend class boost::serialization::access;
@@ -490,7 +492,7 @@ protected:
 
 		 // The following random distribution slightly favours values < 1. Selection pressure
 		 // will keep the values higher if needed
-		 sigma_ *= gexp(GAdaptorT<num_type, fp_type>::m_normal_distribution(gr, typename std::normal_distribution<fp_type>::param_type(0., gfabs(sigmaSigma_))));
+		 sigma_ *= static_cast<fp_type>(gexp(GAdaptorT<num_type>::m_normal_distribution(gr, Gem::Hap::ziggurat_normal_distribution<double>::param_type(0., gfabs(sigmaSigma_)))));
 
 		 // make sure sigma_ doesn't get out of range
 		 Gem::Common::enforceRangeConstraint<fp_type>(sigma_, minSigma_, maxSigma_, "GNumGaussAdaptorT<>::customAdaptAdaption()", false /* silent */);
@@ -515,7 +517,7 @@ protected:
 		 using namespace Gem::Common;
 		 using namespace Gem::Hap;
 
-		 sigma_ = GAdaptorT<num_type, fp_type>::m_uniform_real_distribution(gr, typename std::uniform_real_distribution<fp_type>::param_type(minSigma_, maxSigma_));
+		 sigma_ = static_cast<fp_type>(GAdaptorT<num_type>::m_uniform_real_distribution(gr, std::uniform_real_distribution<double>::param_type(minSigma_, maxSigma_)));
 
 		 return true;
 	 }
@@ -99,6 +99,12 @@ const std::uint32_t DEFREPULSIONTHRESHOLD = 0;
  */
 const std::size_t DEFMAXRETRIESUNTILVALID=10;
 
+/******************************************************************************/
+/**
+ * The cost assumed for validity checks whose cost has not been declared
+ */
+const double DEFAULTVALIDITYCHECKCOST = 1.;
+
 /******************************************************************************/
 /**
  * Indicates whether only active, inactive or all parameters should be extracted
@@ -268,6 +274,29 @@ const std::string DEFAULTTERMINATIONFILE = "empty";
  */
 const std::uint32_t DEFAULTREPORTITER = 1;
 
+/******************************************************************************/
+/**
+ * The seed of reproducible random streams. When set to a value other than 0,
+ * the random streams of optimization algorithms and of the adaption and random
+ * initialization of their individuals are keyed by (seed, iteration, population
+ * position), so that results do not depend on thread counts or scheduling.
+ * 0 disables this mode.
+ */
+const std::uint64_t DEFAULTREPRODUCIBLESEED = 0;
+
+/**
+ * The "population position" used for the random stream of the optimization
+ * algorithm itself in reproducible mode
+ */
+const std::uint32_t REPRODUCIBLEALGORITHMSTREAM = 0xFFFFFFFF;
+
+/**
+ * Set in the "population position" of the random stream used for the random
+ * initialization of individuals in reproducible mode, so that it differs from
+ * the stream used for their adaption in the same iteration
+ */
+const std::uint32_t REPRODUCIBLEINITSTREAMFLAG = 0x80000000;
+
 /******************************************************************************/
 /**
  * The number of iterations after which a checkpoint should be written.
@@ -398,6 +427,7 @@ const double DEFAULTQUALITYTHRESHOLD=0.;
 enum class validityCheckCombinerPolicy : Gem::Common::ENUMBASETYPE {
 	MULTIPLYINVALID = 0   // Multiplies all invalid checks (i.e. return values > 1) or returns 0, if all checks are valid
 	, ADDINVALID = 1      // Adds all invalid checks or returns 0, if all checks are valid
+	, FIRSTINVALID = 2    // Returns the invalidity of the first failing check (by declared cost, then registration order) or 0, if all checks are valid
 };
 
 /******************************************************************************/
@@ -531,6 +561,7 @@ const double DEFMINADPROB = 0.001; ///< The lower boundary for variations of adP
 const double DEFMAXADPROB = 1.0; ///< The upper boundary for variations of adProb_
 const std::uint32_t DEFAULTADAPTIONTHRESHOLD = 1; // Adaption parameters should be adapted whenever an adaption takes place
 const double DEFAULTADAPTADAPTIONPROB = 0.1; // 10 percent probability for the adaption of adaption parameters
+const double SKIPSAMPLINGMAXADPROB = 0.25; ///< Below this adaption probability, adapted positions in collections are found by sampling the gaps between them
 
 /******************************************************************************/
 // Adaption modes
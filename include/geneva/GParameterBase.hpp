@@ -41,6 +41,7 @@
 
 // Standard header files go here
 #include <random>
+#include <typeinfo>
 
 // Boost header files go here
 #include <boost/uuid/uuid.hpp>
@@ -49,6 +50,7 @@
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_serialize.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/container_hash/hash.hpp>
 
 // Geneva header files go here
 #include "common/GExceptions.hpp"
@@ -113,6 +115,13 @@ public:
         , std::vector<boost::any> &data
     ) const;
 
+    /** @brief Makes this object the first member of a group of objects sharing a single adaptor */
+    G_API_GENEVA bool startAdaptorGroup();
+    /** @brief Lets this object join the adaptor group of another object */
+    G_API_GENEVA bool joinAdaptorGroup(const GParameterBase &);
+    /** @brief Lets this object leave its adaptor group */
+    G_API_GENEVA void leaveAdaptorGroup();
+
     /** @brief Switches on adaptions for this object */
     G_API_GENEVA bool setAdaptionsActive();
     /** @brief Disables adaptions for this object */
@@ -423,6 +432,13 @@ public:
     /** @brief Lets the audience know whether this is a leaf or a branch object */
     virtual G_API_GENEVA bool isLeaf() const BASE;
 
+    /** @brief Adds a description of the structure of this object to a fingerprint */
+    G_API_GENEVA void addToFingerprint(std::size_t &) const;
+    /** @brief Loads the data of another object of identical structure without further checks */
+    G_API_GENEVA void loadValues(const GParameterBase &);
+    /** @brief Adds all objects holding parameter values to a list, in the order of streamline() */
+    G_API_GENEVA void collectLeaves(std::vector<const GParameterBase *> &) const;
+
     /***************************************************************************/
     /**
      * This function converts a GParameterBase std::shared_ptr to the target type.  Note that this
@@ -646,6 +662,13 @@ protected:
     /** @brief Loads the data of another GObject */
     G_API_GENEVA void load_(const GObject *) override;
 
+    /** @brief Adds a description of the structure of this object to a fingerprint */
+    virtual G_API_GENEVA void fingerprint_(std::size_t &) const BASE;
+    /** @brief Loads the data of another object of identical type and structure */
+    virtual G_API_GENEVA void loadValues_(const GParameterBase &) BASE;
+    /** @brief Adds all objects holding parameter values to a list */
+    virtual G_API_GENEVA void collectLeaves_(std::vector<const GParameterBase *> &) const BASE;
+
     /** @brief Allow access to this classes compare_ function */
     friend void Gem::Common::compare_base_t<GParameterBase>(
         GParameterBase const &
@@ -692,6 +715,13 @@ private:
         , std::vector<boost::any> &data
     ) const BASE = 0;
 
+    /** @brief Makes this object the first member of an adaptor group */
+    virtual G_API_GENEVA bool startAdaptorGroup_() BASE;
+    /** @brief Lets this object join the adaptor group of another object */
+    virtual G_API_GENEVA bool joinAdaptorGroup_(const GParameterBase &) BASE;
+    /** @brief Lets this object leave its adaptor group */
+    virtual G_API_GENEVA void leaveAdaptorGroup_() BASE;
+
     /** @brief Allows to identify whether we are dealing with a collection or an individual parameter */
     virtual G_API_GENEVA bool isIndividualParameter_() const BASE;
 
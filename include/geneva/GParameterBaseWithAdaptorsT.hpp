@@ -40,6 +40,7 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard header files go here
+#include <atomic>
 
 // Boost header files go here
 
@@ -75,9 +76,22 @@ class GParameterBaseWithAdaptorsT
 	 void serialize(Archive & ar, const unsigned int) {
 		 using boost::serialization::make_nvp;
 
+		 // Members of an adaptor group store the common adaptor
+		 if(not Archive::is_loading::value && adaptorGroup_) {
+			 adaptor_ = adaptorGroup_->adaptor;
+		 }
+
 		 ar
 		 & BOOST_SERIALIZATION_BASE_OBJECT_NVP(GParameterBase)
 		 & BOOST_SERIALIZATION_NVP(adaptor_);
+
+		 // Tracking may let several de-serialized objects point to the same adaptor.
+		 // Group membership is not serialized (see GParameterTCollectionT).
+		 if(Archive::is_loading::value) {
+			 adaptorGroup_.reset();
+			 spareAdaptor_.reset();
+			 adaptorShared_ = true;
+		 }
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -90,14 +104,21 @@ public:
 
 	 /***************************************************************************/
 	 /**
-	  * The copy constructor.
+	  * The copy constructor. The adaptor is shared with the original object
+	  * and only copied once either side is about to modify it (see ownAdaptor()).
+	  * Both objects are marked as sharing their adaptor. Marking the original only
+	  * stores to an atomic flag, so the same object may be copied in several threads
+	  * at once.
 	  *
 	  * @param cp A copy of another GParameterBaseWithAdaptorsT object
 	  */
 	 GParameterBaseWithAdaptorsT(const GParameterBaseWithAdaptorsT<T>& cp)
 		 : GParameterBase(cp)
-		 , adaptor_((cp.adaptor_)->GObject::template clone<GAdaptorT<T>>())
-	 { /* nothing */ }
+		 , adaptor_(cp.currentAdaptor())
+		 , adaptorShared_(true)
+	 {
+		 cp.markAdaptorShared();
+	 }
 
 	 /***************************************************************************/
 	 /**
@@ -123,11 +144,13 @@ public:
 			 );
 		 }
 
-		 if(adaptor_) { // Is an adaptor already present ?
-			 if (adaptor_->getAdaptorId() == gat_ptr->getAdaptorId()) {
-				 adaptor_->GObject::load(gat_ptr);
+		 if(this->currentAdaptor()) { // Is an adaptor already present ?
+			 if (this->currentAdaptor()->getAdaptorId() == gat_ptr->getAdaptorId()) {
+				 this->ownAdaptor().GObject::load(gat_ptr);
 			 } else { // Different type - need to clone and assign to gat_ptr
+				 this->leaveAdaptorGroup_();
 				 adaptor_ = gat_ptr->GObject::template clone<GAdaptorT<T>>();
+				 adaptorShared_ = false;
 			 }
 		 } else { // None there ? This should not happen
 			 throw gemfony_exception(
@@ -149,12 +172,14 @@ public:
 	 /**
 	  * Retrieves the adaptor. Throws in DBEUG mode , if we have no adaptor. It is assumed
 	  * that only the object holding the "master" adaptor pointer should be allowed to modify it.
+	  * As the caller may modify the adaptor, an adaptor shared with copies of this object
+	  * is replaced by a private copy first.
 	  *
 	  * @return A std::shared_ptr to the adaptor
 	  */
-	 std::shared_ptr<GAdaptorT<T>> getAdaptor() const {
+	 std::shared_ptr<GAdaptorT<T>> getAdaptor() {
 #ifdef DEBUG
-		 if(not adaptor_) {
+		 if(not this->currentAdaptor()) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GParameterBaseWithAdaptorsT::getAdaptor() :" << std::endl
@@ -164,7 +189,29 @@ public:
 		 }
 #endif /* DEBUG */
 
-		 return adaptor_;
+		 return this->ownAdaptorPtr();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives read-only access to the adaptor. The adaptor may be shared with copies
+	  * of this object, so it is not copied here (see currentAdaptor()).
+	  *
+	  * @return A std::shared_ptr to the unmodifiable adaptor
+	  */
+	 std::shared_ptr<const GAdaptorT<T>> getAdaptor() const {
+#ifdef DEBUG
+		 if(not this->currentAdaptor()) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GParameterBaseWithAdaptorsT::getAdaptor() const :" << std::endl
+					 << "with typeid(T).name() = " << typeid(T).name() << std::endl
+					 << "Tried to retrieve adaptor while none is present" << std::endl
+			 );
+		 }
+#endif /* DEBUG */
+
+		 return this->currentAdaptor();
 	 }
 
 	 /* ----------------------------------------------------------------------------------
@@ -186,9 +233,9 @@ public:
 	 template <typename adaptor_type>
 	 std::shared_ptr<adaptor_type> getAdaptor(
 		 typename std::enable_if<std::is_base_of<GAdaptorT<T>, adaptor_type>::value>::type *dummy = nullptr
-	 ) const {
+	 ) {
 #ifdef DEBUG
-		 if(not adaptor_) {
+		 if(not this->currentAdaptor()) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GParameterBaseWithAdaptorsT::getAdaptor<adaptor_type>()" << std::endl
@@ -202,7 +249,7 @@ public:
 #endif /* DEBUG */
 
 		 // Does error checks on the conversion internally
-		 return Gem::Common::convertSmartPointer<GAdaptorT<T>,adaptor_type>(adaptor_);
+		 return Gem::Common::convertSmartPointer<GAdaptorT<T>,adaptor_type>(this->ownAdaptorPtr());
 	 }
 
 	 /* ----------------------------------------------------------------------------------
@@ -217,7 +264,9 @@ public:
 	  * This function resets the local adaptor_ pointer.
 	  */
 	 void resetAdaptor() {
+		 this->leaveAdaptorGroup_();
 		 adaptor_ = getDefaultAdaptor<T>();
+		 adaptorShared_ = false;
 	 }
 
 	 /* ----------------------------------------------------------------------------------
@@ -232,7 +281,7 @@ public:
 	  * @return A boolean indicating whether adaptors are present
 	  */
 	 bool hasAdaptor() const override {
-		 if(adaptor_) return true;
+		 if(this->currentAdaptor()) return true;
 		 return false;
 	 }
 
@@ -245,7 +294,10 @@ protected:
 	 /***************************************************************************/
 	 /**
 	  * Loads the data of another GParameterBaseWithAdaptorsT object, which
-	  * is camouflaged as a GObject.
+	  * is camouflaged as a GObject. The other object's adaptor is shared rather
+	  * than copied, so that no adaptor data needs to be copied for objects that
+	  * are not adapted afterwards. An adaptor owned exclusively by this object
+	  * is kept for re-use, should a private copy be needed later.
 	  *
 	  * @param cp A copy of another GParameterBaseWithAdaptorsT, camouflaged as a GObject
 	  */
@@ -259,7 +311,7 @@ protected:
 		 // and then our local data
 #ifdef DEBUG
 		 // Check that both we and the "foreign" object have an adaptor
-		 if(not adaptor_ || not p_load->adaptor_) {
+		 if(not this->currentAdaptor() || not p_load->currentAdaptor()) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GParameterBaseWithAdaptorsT<T>::load_():" << std::endl
@@ -267,12 +319,20 @@ protected:
 			 );
 		 }
 #endif
-		 // Same type: We can just load the data
-		 if (adaptor_->getAdaptorId() == p_load->adaptor_->getAdaptorId()) {
-			 adaptor_->GObject::load(p_load->adaptor_);
-		 } else { // Different type - need to convert
-			 adaptor_ = p_load->adaptor_->GObject::template clone<GAdaptorT<T>>();
-		 }
+		 this->shareAdaptor(*p_load);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Loads the data of another object of identical type and structure
+	  * (see GParameterBase::loadValues())
+	  *
+	  * @param cp Another object of identical type and structure
+	  */
+	 void loadValues_(const GParameterBase& cp) override {
+		 // Identical types are guaranteed by GParameterBase::loadValues()
+		 GParameterBase::loadValues_(cp);
+		 this->shareAdaptor(static_cast<const GParameterBaseWithAdaptorsT<T>&>(cp));
 	 }
 
 	/***************************************************************************/
@@ -308,7 +368,7 @@ protected:
 		Gem::Common::compare_base_t<GParameterBase>(*this, *p_load, token);
 
 		// We access the relevant data of one of the parent classes directly for simplicity reasons
-		compare_t(IDENTITY(adaptor_, p_load->adaptor_), token);
+		compare_t(IDENTITY(this->currentAdaptor(), p_load->currentAdaptor()), token);
 
 		// React on deviations from the expectation
 		token.evaluate();
@@ -335,7 +395,7 @@ protected:
 		 , Gem::Hap::GRandomBase& gr
 	 ) {
 #ifdef DEBUG
-		 if (not adaptor_) {
+		 if (not this->currentAdaptor()) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GParameterBaseWithAdaptorsT<T>::applyAdaptor(value,range):" << std::endl
@@ -346,7 +406,7 @@ protected:
 #endif /* DEBUG */
 
 		 // Apply the adaptor
-		 return adaptor_->adapt(value, range, gr);
+		 return this->ownAdaptor().adapt(value, range, gr);
 	 }
 
 	 /***************************************************************************/
@@ -364,7 +424,7 @@ protected:
 		 , Gem::Hap::GRandomBase& gr
 	 ) {
 #ifdef DEBUG
-		 if(not adaptor_) {
+		 if(not this->currentAdaptor()) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In GParameterBaseWithAdaptorsT<T>::applyAdaptor(collection, range, gr):" << std::endl
@@ -375,7 +435,7 @@ protected:
 #endif /* DEBUG */
 
 		 // Apply the adaptor to each data item in turn
-		 return adaptor_->adapt(collection, range, gr);
+		 return this->ownAdaptor().adapt(collection, range, gr);
 	 }
 
 	/***************************************************************************/
@@ -485,7 +545,7 @@ private:
      */
     bool updateAdaptorsOnStall_(std::size_t nStalls) override {
 #ifdef DEBUG
-        if (not adaptor_) {
+        if (not this->currentAdaptor()) {
             throw gemfony_exception(
                     g_error_streamer(DO_LOG, time_and_place)
                             << "In GParameterBaseWithAdaptorsT<T>::updateAdaptorsOnStall_(...):" << std::endl
@@ -495,7 +555,7 @@ private:
         }
 #endif /* DEBUG */
 
-        return this->adaptor_->updateOnStall(nStalls, this->range());
+        return this->ownAdaptor().updateOnStall(nStalls, this->range());
     }
 
 	/******************************************************************************/
@@ -512,7 +572,7 @@ private:
 			, std::vector<boost::any>& data
 	) const override {
 #ifdef DEBUG
-		if (not adaptor_) {
+		if (not this->currentAdaptor()) {
 			throw gemfony_exception(
 					g_error_streamer(DO_LOG, time_and_place)
 							<< "In GParameterBaseWithAdaptorsT<T>::queryAdaptor:(...):" << std::endl
@@ -524,26 +584,221 @@ private:
 
 		// Note: The following will throw if the adaptor with name "adaptorName" has
 		// no property named "property".
-		this->adaptor_->queryPropertyFrom(adaptorName, property, data);
+		this->currentAdaptor()->queryPropertyFrom(adaptorName, property, data);
 	}
 
+	 /***************************************************************************/
+	 /**
+	  * Makes this object the first member of an adaptor group. The object receives
+	  * its own copy of the adaptor, if it is currently shared with other objects.
+	  *
+	  * @return true, as this object has an adaptor that may be shared
+	  */
+	 bool startAdaptorGroup_() override {
+		 this->leaveAdaptorGroup_();
+		 this->ownAdaptorPtr(); // Needs to happen before adaptorGroup_ is set
+
+		 adaptorGroup_ = std::make_shared<adaptorGroup>();
+		 adaptorGroup_->adaptor = adaptor_;
+		 adaptorShared_ = true; // The group holds the adaptor as well
+		 return true;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Lets this object join the adaptor group of another object, provided both
+	  * use the same parameter and adaptor types. The adaptor previously used by
+	  * this object is released.
+	  *
+	  * @param leader An object belonging to an adaptor group
+	  * @return A boolean indicating whether the group was joined
+	  */
+	 bool joinAdaptorGroup_(const GParameterBase& leader) override {
+		 const GParameterBaseWithAdaptorsT<T> *p_leader = dynamic_cast<const GParameterBaseWithAdaptorsT<T> *>(&leader);
+		 if (
+			 not p_leader
+			 || not p_leader->adaptorGroup_
+			 || not this->currentAdaptor()
+			 || this->currentAdaptor()->getAdaptorId() != p_leader->currentAdaptor()->getAdaptorId()
+		 ) {
+			 return false;
+		 }
+
+		 if (p_leader != this) {
+			 this->leaveAdaptorGroup_();
+			 spareAdaptor_.reset();
+			 adaptorGroup_ = p_leader->adaptorGroup_;
+			 adaptor_ = adaptorGroup_->adaptor;
+			 adaptorShared_ = true; // The group holds the adaptor as well
+		 }
+
+		 return true;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Lets this object leave its adaptor group. The adaptor stays shared with
+	  * the other members until one of them is about to modify it.
+	  */
+	 void leaveAdaptorGroup_() override {
+		 if (adaptorGroup_) {
+			 adaptor_ = adaptorGroup_->adaptor;
+			 adaptorShared_ = true;
+			 adaptorGroup_.reset();
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Lets this object share the adaptor of another object. Both objects are
+	  * marked as sharing their adaptor. An adaptor owned exclusively by this
+	  * object is kept for re-use (see ownAdaptor()). Like copy construction,
+	  * this only marks the other object through an atomic flag (it is called
+	  * from load_() and loadValues_()).
+	  *
+	  * @param cp The object whose adaptor should be shared
+	  */
+	 void shareAdaptor(const GParameterBaseWithAdaptorsT<T>& cp) {
+		 this->leaveAdaptorGroup_(); // Copies never belong to the adaptor group of the original
+
+		 if (adaptor_ != cp.currentAdaptor()) {
+			 if (not adaptorShared_) {
+				 spareAdaptor_ = std::move(adaptor_);
+			 }
+			 adaptor_ = cp.currentAdaptor();
+		 }
+
+		 adaptorShared_ = true;
+		 cp.markAdaptorShared();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Records that the adaptor of this object is now held by another object as
+	  * well. For members of an adaptor group, this applies to the whole group.
+	  */
+	 void markAdaptorShared() const noexcept {
+		 if (adaptorGroup_) {
+			 adaptorGroup_->shared = true;
+		 } else {
+			 adaptorShared_ = true;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives access to the adaptor currently in use, without modifying it. This is
+	  * the common adaptor for members of an adaptor group, and adaptor_ otherwise.
+	  *
+	  * @return The adaptor currently in use
+	  */
+	 std::shared_ptr<GAdaptorT<T>> const& currentAdaptor() const {
+		 return adaptorGroup_ ? adaptorGroup_->adaptor : adaptor_;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives access to an adaptor that may be modified (see ownAdaptorPtr())
+	  *
+	  * @return A reference to an adaptor that may be modified by this object
+	  */
+	 GAdaptorT<T>& ownAdaptor() {
+		 return *(this->ownAdaptorPtr());
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives access to an adaptor that may be modified. Adaptors are shared between
+	  * copies of an object (see the copy constructor and load_()), until one of them
+	  * is about to modify it. At this point the object receives its own copy, re-using
+	  * the storage of an adaptor it owned earlier where possible. Members of an adaptor
+	  * group (see startAdaptorGroup()) instead modify the common adaptor. If objects
+	  * outside of the group hold it as well, the group receives a single new copy
+	  * that is used by all of its members from then on.
+	  *
+	  * Whether an adaptor is shared is recorded explicitly in adaptorShared_ and in the
+	  * group, rather than derived from reference counts. Reference counts change while
+	  * other copies of an object are adapted in parallel, and they also include handles
+	  * returned by getAdaptor(). Objects that are copied or loaded from only ever set
+	  * these flags, and they are atomic, so an object may serve as the source of copies
+	  * in several threads at once. As for any modification, an object must not be
+	  * adapted while it is being copied in another thread.
+	  *
+	  * @return The adaptor that may be modified by this object
+	  */
+	 std::shared_ptr<GAdaptorT<T>> const& ownAdaptorPtr() {
+		 if (adaptorGroup_) {
+			 if (adaptorGroup_->shared) {
+				 adaptorGroup_->adaptor = adaptorGroup_->adaptor->GObject::template clone<GAdaptorT<T>>();
+				 adaptorGroup_->shared = false;
+			 }
+			 adaptor_ = adaptorGroup_->adaptor;
+			 return adaptor_;
+		 }
+
+		 if (adaptorShared_) {
+			 if (spareAdaptor_ && spareAdaptor_->getAdaptorId() == adaptor_->getAdaptorId()) {
+				 spareAdaptor_->GObject::load(adaptor_);
+				 adaptor_ = std::move(spareAdaptor_);
+			 } else {
+				 adaptor_ = adaptor_->GObject::template clone<GAdaptorT<T>>();
+			 }
+			 adaptorShared_ = false;
+		 }
+		 spareAdaptor_.reset();
+
+		 return adaptor_;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * The data shared by the members of an adaptor group
+	  */
+	 struct adaptorGroup {
+		 std::shared_ptr<GAdaptorT<T>> adaptor; ///< The adaptor common to all members of the group
+		 std::atomic<bool> shared{false}; ///< Set when objects outside of the group hold the adaptor as well
+	 };
+
 	 /***************************************************************************/
 	 /**
 	  * @brief Holds the adaptor used for adaption of the values stored in derived classes.
+	  * The adaptor may be shared with copies of this object as long as none of them modifies it.
+	  * For members of an adaptor group, the common adaptor is held by the group (see
+	  * currentAdaptor()).
 	  */
 	 std::shared_ptr<GAdaptorT<T>> adaptor_{Gem::Geneva::getDefaultAdaptor<T>()};
+	 /**
+	  * @brief Set when adaptor_ may be held by other objects, so that it needs to be copied
+	  * before it is modified. Atomic, as copies of this object may mark it from several
+	  * threads at once (see markAdaptorShared()). Not serialized.
+	  */
+	 mutable std::atomic<bool> adaptorShared_{false};
+	 /**
+	  * @brief An adaptor previously owned by this object, kept for re-use when a shared
+	  * adaptor needs to be copied. Neither serialized nor copied.
+	  */
+	 std::shared_ptr<GAdaptorT<T>> spareAdaptor_;
+	 /**
+	  * @brief The adaptor group this object belongs to, if any. All members of a group
+	  * hold the same object. Neither serialized nor copied.
+	  */
+	 std::shared_ptr<adaptorGroup> adaptorGroup_;
 };
 
 /******************************************************************************/
 /////////////////////////// Specializations for T == bool //////////////////////
 /******************************************************************************/
 /**
- * This function applies the first adaptor of the adaptor sequence to a collection of values.
- * Note that the parameter of this function will get changed. This is a specialization of a
- * generic template function which is needed due to the peculiarities of a std::vector<bool>
- * (which doesn't return a bool but an object).
+ * This function applies our adaptor to a collection of values. Note that the parameter
+ * of this function will get changed. This is a specialization of a generic template
+ * function which is needed due to the peculiarities of a std::vector<bool> (which doesn't
+ * return a bool but an object). Each bit is adapted through a call to the single-value
+ * adapt() function, so that the adaption probability is self-adapted once per bit. Only
+ * adaptors that ask for it (see GAdaptorT<T>::adaptsBitsWordWise()) receive the entire
+ * collection at once.
  *
  * @param collection A vector of values that shall be adapted
+ * @param range A typical value range of underlying parameter types
  * @return The number of adaptions that were carried out
  */
 template <>
@@ -553,21 +808,26 @@ inline std::size_t GParameterBaseWithAdaptorsT<bool>::applyAdaptor(
 	, Gem::Hap::GRandomBase& gr
 ) {
 #ifdef DEBUG
-	if(not adaptor_) {
+	if(not this->currentAdaptor()) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG, time_and_place)
-				<< "In GParameterBaseWithAdaptorsT<T>::applyAdaptor(std::vector<bool>& collection):" << std::endl
+				<< "In GParameterBaseWithAdaptorsT<bool>::applyAdaptor(std::vector<bool>& collection):" << std::endl
 				<< "Error: No adaptor was found." << std::endl
 		);
 	}
 #endif /* DEBUG */
 
+	GAdaptorT<bool>& adaptor = this->ownAdaptor();
+	if(adaptor.adaptsBitsWordWise()) {
+		return adaptor.adapt(collection, range, gr);
+	}
+
 	std::size_t nAdapted = 0;
 
 	std::vector<bool>::iterator it;
 	for (it = collection.begin(); it != collection.end(); ++it) {
 		bool value = *it;
-		if(1 == adaptor_->adapt(value, range, gr)) {
+		if(1 == adaptor.adapt(value, range, gr)) {
 			*it = value;
 			nAdapted += 1;
 		}
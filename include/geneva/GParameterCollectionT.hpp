@@ -255,6 +255,32 @@ protected:
         Gem::Common::GPODVectorT<num_type>::operator=(*p_load);
     }
 
+    /***************************************************************************/
+    /**
+     * Adds the size of the collection to the fingerprint (see GParameterBase::addToFingerprint())
+     *
+     * @param seed The fingerprint to which the description should be added
+     */
+    void fingerprint_(std::size_t &seed) const override {
+        GParameterBaseWithAdaptorsT<num_type>::fingerprint_(seed);
+        boost::hash_combine(seed, this->size());
+    }
+
+    /***************************************************************************/
+    /**
+     * Loads the data of another object of identical type and structure
+     * (see GParameterBase::loadValues())
+     *
+     * @param cp Another object of identical type and structure
+     */
+    void loadValues_(const GParameterBase &cp) override {
+        // Load our parent class'es data ...
+        GParameterBaseWithAdaptorsT<num_type>::loadValues_(cp);
+
+        // ... and then our local data. Identical types are guaranteed by GParameterBase::loadValues()
+        Gem::Common::GPODVectorT<num_type>::operator=(static_cast<const GParameterCollectionT<num_type>&>(cp));
+    }
+
     /** @brief Allow access to this classes compare_ function */
     friend void Gem::Common::compare_base_t<GParameterCollectionT<num_type>>(
         GParameterCollectionT<num_type> const &
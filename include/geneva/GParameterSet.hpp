@@ -44,6 +44,10 @@
 #include <typeinfo>
 #include <limits>
 #include <functional>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
 
 // Boost header files go here
 #include <boost/numeric/conversion/bounds.hpp>
@@ -264,10 +268,14 @@ public:
     /** @brief Checks whether this object is better than a given set of evaluations */
     G_API_GENEVA bool isGoodEnough(std::vector<double> const &);
 
-    /** @brief Perform a cross-over operation between this object and another */
-    virtual G_API_GENEVA std::shared_ptr<GParameterSet> crossOverWith(
+    /** @brief Perform a cross-over operation between this object and another, returning a modified copy */
+    G_API_GENEVA std::shared_ptr<GParameterSet> crossOverWith(
         std::shared_ptr<GParameterSet> const &
-    ) const BASE;
+    ) const;
+    /** @brief Perform a cross-over operation between this object and another, modifying this object */
+    virtual G_API_GENEVA void crossOver(
+        std::shared_ptr<GParameterSet> const &
+    ) BASE;
 
     /** @brief Triggers updates of adaptors contained in this object */
     G_API_GENEVA void updateAdaptorsOnStall(std::uint32_t);
@@ -325,11 +333,17 @@ public:
     /** @brief Retrieves the number of adaptions performed during the last call to adapt() */
     G_API_GENEVA std::size_t getNAdaptions() const;
 
+    /** @brief Calculates a fingerprint of the types and sizes of all stored parameter objects */
+    G_API_GENEVA std::size_t structuralFingerprint() const;
+
     /** @brief Allows to set the current iteration of the parent optimization algorithm. */
     G_API_GENEVA void setAssignedIteration(std::uint32_t const &);
     /** @brief Gives access to the parent optimization algorithm's iteration */
     G_API_GENEVA std::uint32_t getAssignedIteration() const;
 
+    /** @brief Positions the local random number stream at the start of the stream identified by (seed, stream) */
+    G_API_GENEVA void setRandomStream(std::uint64_t seed, std::uint64_t stream);
+
     /** @brief Allows to specify the number of optimization cycles without improvement of the primary fitness criterion */
     G_API_GENEVA void setNStalls(std::uint32_t const &);
     /** @brief Allows to retrieve the number of optimization cycles without improvement of the primary fitness criterion */
@@ -507,13 +521,14 @@ public:
     template<typename par_type>
     std::vector<std::string> getVariableNames() const {
         std::vector<std::string> varNames;
-        std::map<std::string, std::vector<par_type>> pMap;
-        this->streamline<par_type>(pMap);
-
-        for (const auto &name: pMap) {
-            varNames.push_back(name.first);
+        for (const auto &entry: this->parameterNameTable<par_type>()) {
+            varNames.push_back(std::get<0>(entry));
         }
 
+        // Names are returned in sorted order and without duplicates
+        std::sort(varNames.begin(), varNames.end());
+        varNames.erase(std::unique(varNames.begin(), varNames.end()), varNames.end());
+
         return varNames;
     }
 
@@ -540,12 +555,31 @@ public:
             case 1: // var[3]
             case 2: // var    --> treated as var[0]
             {
-                std::map<std::string, std::vector<par_type>> varMap;
-                this->streamline<par_type>(varMap);
-                result = (
-                    Gem::Common::getMapItem<std::vector<par_type>>(
-                        varMap
-                        , std::get<1>(target))).at(std::get<2>(target));
+                std::vector<par_type> vars;
+                this->streamline<par_type>(vars);
+                auto nameTable = this->parameterNameTable<par_type>();
+
+                // The last object with a given name takes precedence, as with the name-based streamline()
+                auto entry_it = std::find_if(
+                    nameTable.rbegin()
+                    , nameTable.rend()
+                    , [&target](std::tuple<std::string, std::size_t, std::size_t> const &entry) -> bool {
+                        return std::get<0>(entry) == std::get<1>(target);
+                    }
+                );
+
+                if (entry_it == nameTable.rend() || std::get<2>(target) >= std::get<2>(*entry_it)) {
+                    throw gemfony_exception(
+                        g_error_streamer(
+                            DO_LOG
+                            , time_and_place
+                        )
+                            << "In GParameterSet::getVarItem(): Error!" << std::endl
+                            << "No item " << std::get<2>(target) << " for variable " << std::get<1>(target) << std::endl
+                    );
+                }
+
+                result = vars.at(std::get<1>(*entry_it) + std::get<2>(target));
             }
                 break;
 
@@ -601,7 +635,10 @@ public:
     /**
      * Loops over all GParameterBase objects. Each object will add the
      * values of its parameters to the vector, if they comply with the
-     * type of the parameters to be stored in the vector.
+     * type of the parameters to be stored in the vector. The required
+     * space is reserved up front, and the capacity of the vector is
+     * retained, so that repeated calls with the same vector do not
+     * allocate memory.
      *
      * @param parVec The vector to which the parameters will be added
      * @param am An enum indicating whether only information about active, inactive or all parameters of this type should be extracted
@@ -611,8 +648,9 @@ public:
         std::vector<par_type> &parVec
         , activityMode const &am = activityMode::DEFAULTACTIVITYMODE
     ) const {
-        // Make sure the vector is clean
+        // Make sure the vector is clean and large enough
         parVec.clear();
+        parVec.reserve(this->countParameters<par_type>(am));
 
         // Loop over all GParameterBase objects.
         for (const auto &parm_ptr: *this) {
@@ -659,6 +697,42 @@ public:
      * ----------------------------------------------------------------------------------
      */
 
+    /***************************************************************************/
+    /**
+     * Creates a table of the names of all parameter objects holding values of
+     * type par_type, together with the position and number of their values in
+     * the vector filled by streamline(std::vector<par_type>&, am). The table only
+     * depends on the structure of the individual (see structuralFingerprint()),
+     * so callers exporting many identically structured individuals may create
+     * it once and then access values by name without the per-call allocations
+     * of streamline(std::map<std::string, std::vector<par_type>>&, am).
+     * Note that, unlike with the map, names may appear more than once.
+     *
+     * @param am An enum indicating whether only information about active, inactive or all parameters of this type should be extracted
+     * @return A vector of tuples holding the name, start position and number of values of each parameter object
+     */
+    template<typename par_type>
+    std::vector<std::tuple<std::string, std::size_t, std::size_t>> parameterNameTable(
+        activityMode const &am = activityMode::DEFAULTACTIVITYMODE
+    ) const {
+        std::vector<const GParameterBase *> leaves;
+        for (const auto &parm_ptr: *this) {
+            parm_ptr->collectLeaves(leaves);
+        }
+
+        std::vector<std::tuple<std::string, std::size_t, std::size_t>> nameTable;
+        std::size_t offset = 0;
+        for (const auto leaf_ptr: leaves) {
+            std::size_t nValues = leaf_ptr->countParameters<par_type>(am);
+            if (0 == nValues) continue;
+
+            nameTable.emplace_back(leaf_ptr->getParameterName(), offset, nValues);
+            offset += nValues;
+        }
+
+        return nameTable;
+    }
+
     /***************************************************************************/
     /**
      * Assigns values from a std::vector to the parameters in the collection
@@ -725,6 +799,77 @@ public:
         this->mark_as_due_for_processing();
     }
 
+    /***************************************************************************/
+    /**
+     * Gives access to a flat, contiguous copy of all parameters of type par_type.
+     * The underlying array is owned by this object and re-used between calls,
+     * so that repeated extraction (e.g. once per iteration of an optimization
+     * algorithm) does not allocate memory once the array has reached its final
+     * size. Alongside the values, the start position of each parameter object's
+     * values is recorded (see flatOffsets()). The array is refreshed from the
+     * parameter tree on every call; changes only reach the parameter objects
+     * through assignFlatValues(). Note that the view is not meant to be shared
+     * between threads.
+     *
+     * @param am An enum indicating whether only information about active, inactive or all parameters of this type should be extracted
+     * @return A reference to the cached array of values
+     */
+    template<typename par_type>
+    std::vector<par_type>& flatValues(
+        activityMode const &am = activityMode::DEFAULTACTIVITYMODE
+    ) {
+        auto& view = this->flatView<par_type>();
+
+        view.values.clear();
+        view.offsets.clear();
+        for (const auto &parm_ptr: *this) {
+            view.offsets.push_back(view.values.size());
+            parm_ptr->streamline<par_type>(
+                view.values
+                , am
+            );
+        }
+        view.offsets.push_back(view.values.size());
+        view.am = am;
+
+        return view.values;
+    }
+
+    /***************************************************************************/
+    /**
+     * Writes the (possibly modified) contents of the cached flat array of type
+     * par_type back to the parameter objects. The activity mode used in the
+     * last call to flatValues() is applied.
+     */
+    template<typename par_type>
+    void assignFlatValues() {
+        auto const& view = this->flatView<par_type>();
+
+        if (view.offsets.empty() || view.offsets.back() != view.values.size()) {
+            throw gemfony_exception(
+                g_error_streamer(
+                    DO_LOG
+                    , time_and_place
+                )
+                    << "In GParameterSet::assignFlatValues<par_type>():" << std::endl
+                    << "No valid flat view available. Call flatValues() first" << std::endl
+            );
+        }
+
+        this->assignValueVector<par_type>(view.values, view.am);
+    }
+
+    /***************************************************************************/
+    /**
+     * Retrieves the index map of the last flat view of type par_type: entry i
+     * holds the position of the first value of the i-th parameter object inside
+     * of the flat array; the last entry holds the total number of values.
+     */
+    template<typename par_type>
+    std::vector<std::size_t> const& flatOffsets() const {
+        return std::get<flat_view<par_type>>(m_flat_views).offsets;
+    }
+
     /***************************************************************************/
     /**
      * Loops over all GParameterBase objects. Each object will add the
@@ -909,9 +1054,10 @@ protected:
     /***************************************************************************/
     /**
      * A random number generator. Note that the actual calculation is
-     * done in a random number proxy / factory
+     * done in a random number proxy / factory, unless a reproducible
+     * stream was selected with setRandomStream()
      */
-    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> m_gr;
+    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> m_gr;
 
     /***************************************************************************/
     /** @brief Do the required processing for this object */
@@ -960,6 +1106,8 @@ protected:
 
     /** @brief Checks whether this solution has been rated to be valid; meant to be called by internal functions only */
     G_API_GENEVA bool parameterSetFulfillsConstraints(double &) const;
+    /** @brief Updates m_validity_level unless it is still current for the parameter values */
+    G_API_GENEVA bool updateValidityLevel();
 
     /** @brief Applies modifications to this object. This is needed for testing purposes */
     G_API_GENEVA bool modify_GUnitTests_() override;
@@ -987,6 +1135,9 @@ private:
     /** @brief Returns all transformed fitness results in a std::vector */
     G_API_GENEVA std::vector<double> transformed_fitness_vec_() const final;
 
+    /** @brief Discards the cached validity level whenever this individual is marked as due for processing */
+    G_API_GENEVA void markedAsDueForProcessing_() override;
+
     /***************************************************************************/
 
     /** @brief Retrieves a parameter of a given type at the specified position */
@@ -1004,6 +1155,78 @@ private:
     /** @brief Retrieval of a suitable position for cross over inside of a vector */
     std::size_t getCrossOverPos(std::size_t, std::size_t);
 
+    /***************************************************************************/
+    /**
+     * Adds the values of all parameters of a given type to the data used by
+     * toCSV(). Values are ordered alphabetically by name, and only the last
+     * object with a given name is considered, as with the name-based streamline().
+     *
+     * @param typeName The name of the parameter type to be recorded
+     * @param withNameAndType Indicates whether names and types should be recorded
+     * @param varNames The names of all variables
+     * @param varTypes The types of all variables
+     * @param varValues The values of all variables
+     */
+    template<typename par_type>
+    void addCSVData(
+        std::string const &typeName
+        , bool withNameAndType
+        , std::vector<std::string> &varNames
+        , std::vector<std::string> &varTypes
+        , std::vector<std::string> &varValues
+    ) const {
+        std::vector<par_type> values;
+        this->streamline<par_type>(values);
+
+        auto nameTable = this->parameterNameTable<par_type>();
+        std::stable_sort(
+            nameTable.begin()
+            , nameTable.end()
+            , [](
+                std::tuple<std::string, std::size_t, std::size_t> const &x
+                , std::tuple<std::string, std::size_t, std::size_t> const &y
+            ) -> bool {
+                return std::get<0>(x) < std::get<0>(y);
+            }
+        );
+
+        for (std::size_t i = 0; i < nameTable.size(); i++) {
+            // Skip objects whose name is used again later on
+            if (i + 1 < nameTable.size() && std::get<0>(nameTable[i + 1]) == std::get<0>(nameTable[i])) continue;
+
+            std::string const &name = std::get<0>(nameTable[i]);
+            std::size_t offset = std::get<1>(nameTable[i]);
+            for (std::size_t pos = 0; pos < std::get<2>(nameTable[i]); pos++) {
+                if (withNameAndType) {
+                    varNames.push_back(name + "_" + Gem::Common::to_string(pos));
+                    varTypes.push_back(typeName);
+                }
+                varValues.push_back(Gem::Common::to_string(values.at(offset + pos)));
+            }
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * A flat copy of all parameters of a given type, together with the start
+     * position of each parameter object's values inside of the array
+     */
+    template<typename par_type>
+    struct flat_view {
+        std::vector<par_type> values; ///< The values of all parameter objects, in the order of the parameter tree
+        std::vector<std::size_t> offsets; ///< The start position of each parameter object's values, plus the total size
+        activityMode am = activityMode::DEFAULTACTIVITYMODE; ///< The activity mode used for the extraction
+    };
+
+    /***************************************************************************/
+    /**
+     * Gives access to the flat view of a given type
+     */
+    template<typename par_type>
+    flat_view<par_type>& flatView() {
+        return std::get<flat_view<par_type>>(m_flat_views);
+    }
+
     /***************************************************************************/
     // Data
 
@@ -1025,6 +1248,8 @@ private:
     std::uint32_t m_assigned_iteration = 0;
     /** @brief Indicates how valid a given solution is */
     double m_validity_level = 0.;
+    /** @brief Indicates whether m_validity_level reflects the current parameter values; not serialized */
+    bool m_validity_level_is_current = false;
     /** @brief Holds the actual personality information */
     std::shared_ptr<GPersonalityTraits> m_pt_ptr;
 
@@ -1047,6 +1272,14 @@ private:
     bool m_useRandomCrash
         = false; ///< Indicates whether the individual should crash at random intervals for debugging purposes
     double m_randomCrashProb = 0.; ///< The probability for a random crash
+
+    /** @brief Cached flat views of the parameters, one per parameter type. Neither copied nor serialized */
+    std::tuple<
+        flat_view<double>
+        , flat_view<float>
+        , flat_view<std::int32_t>
+        , flat_view<bool>
+    > m_flat_views;
 };
 
 } /* namespace Geneva */
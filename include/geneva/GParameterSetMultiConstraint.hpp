@@ -40,8 +40,11 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard header files go here
+#include <memory>
+#include <vector>
 
 // Boost header files go here
+#include <boost/functional/hash.hpp>
 
 // Geneva header files go here
 #include "common/GCommonHelperFunctionsT.hpp"
@@ -139,7 +142,7 @@ public:
     /** @brief The default constructor */
     explicit G_API_GENEVA GParameterSetFormulaConstraint(std::string);
     /** @brief The copy constructor */
-    G_API_GENEVA GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &) = default;
+    G_API_GENEVA GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &);
     /** @brief The destructor */
     G_API_GENEVA ~GParameterSetFormulaConstraint() override = default;
 
@@ -173,7 +176,25 @@ private:
     /** @brief The default constructor -- intentionally private, only needed for (de-)serialization */
     G_API_GENEVA GParameterSetFormulaConstraint() = default;
 
+    /** @brief Extracts the double values of an individual, updating the slot positions if necessary */
+    G_API_GENEVA void extractValues(const GParameterSet *) const;
+    /** @brief Determines the positions of the formula's variables in the streamlined double values */
+    G_API_GENEVA void updateSlotPositions(const GParameterSet *) const;
+
     std::string rawFormula_; ///< Holds the raw formula, in which values haven't been replaced yet
+
+    // The compiled formula and the mapping of its variables, created upon the first check.
+    // Not copied, as the parser holds its own evaluation stack.
+    mutable std::shared_ptr<Gem::Common::GFormulaParserT<double>> formulaParser_ptr_; ///< Parses the formula only once
+    mutable std::vector<std::size_t> slotPositions_; ///< The position of each formula variable in the streamlined values
+    mutable std::vector<std::size_t> slotOffsets_; ///< The value offsets of the parameter objects the slot positions were determined for
+    mutable std::size_t slotNameHash_ = 0; ///< A hash of the parameter names the slot positions were determined for
+    mutable std::vector<std::size_t> valueOffsets_; ///< The value offsets of the parameter objects of the last individual
+    mutable std::size_t nameHash_ = 0; ///< A hash of the parameter names of the last individual
+    mutable std::vector<const GParameterBase *> leaves_; ///< The parameter objects of the last individual holding values
+    mutable std::vector<double> parameterValues_; ///< The double values of the last individual
+    mutable std::vector<double> slotValues_; ///< The values of the formula's variables, re-used between checks
+    mutable bool slotPositionsValid_ = false; ///< Indicates whether slotPositions_ may be used
 };
 
 /******************************************************************************/
@@ -230,6 +230,21 @@ protected:
 		 m_val = p_load->m_val;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Loads the data of another object of identical type and structure
+	  * (see GParameterBase::loadValues())
+	  *
+	  * @param cp Another object of identical type and structure
+	  */
+	 void loadValues_(const GParameterBase& cp) override {
+		 // Load our parent class'es data ...
+		 GParameterBaseWithAdaptorsT<T>::loadValues_(cp);
+
+		 // ... and then our own data. Identical types are guaranteed by GParameterBase::loadValues()
+		 m_val = static_cast<const GParameterT<T>&>(cp).m_val;
+	 }
+
 	/** @brief Allow access to this classes compare_ function */
 	friend void Gem::Common::compare_base_t<GParameterT<T>>(
 		GParameterT<T> const &
@@ -43,6 +43,7 @@
 #include <type_traits>
 
 // Boost header files go here
+#include <boost/serialization/version.hpp>
 
 // Geneva header files go here
 #include "common/GCommonHelperFunctionsT.hpp"
@@ -72,7 +73,7 @@ class GParameterTCollectionT
     friend class boost::serialization::access;
 
     template<typename Archive>
-    void serialize(Archive &ar, const unsigned int) {
+    void serialize(Archive &ar, const unsigned int version) {
         using boost::serialization::make_nvp;
 
         // Save the data
@@ -83,6 +84,18 @@ class GParameterTCollectionT
         & make_nvp(
             "GStdPtrVectorInterfaceT_T"
             , boost::serialization::base_object<Gem::Common::GPtrVectorT<T, Gem::Geneva::GObject>>(*this));
+
+        // Adaptor sharing was added in version 1
+        if (version > 0) {
+            ar & BOOST_SERIALIZATION_NVP(m_shareAdaptors);
+        } else {
+            m_shareAdaptors = false;
+        }
+
+        // Group membership is not serialized and needs to be re-established
+        if (Archive::is_loading::value && m_shareAdaptors) {
+            this->groupAdaptors();
+        }
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -127,7 +140,16 @@ public:
      *
      * @param cp A copy of another GParameterTCollectionT<T> object
      */
-    GParameterTCollectionT(const GParameterTCollectionT<T> &cp) = default;
+    GParameterTCollectionT(const GParameterTCollectionT<T> &cp)
+        : GParameterBase(cp)
+        , Gem::Common::GPtrVectorT<T, Gem::Geneva::GObject>(cp)
+        , m_shareAdaptors(cp.m_shareAdaptors)
+    {
+        // Copies of the stored objects do not belong to the adaptor groups of the originals
+        if (m_shareAdaptors) {
+            this->groupAdaptors();
+        }
+    }
 
     /***************************************************************************/
     /**
@@ -135,6 +157,47 @@ public:
      */
     ~GParameterTCollectionT() override = default;
 
+    /***************************************************************************/
+    /**
+     * Allows to let all stored objects with identical parameter and adaptor types
+     * share a single adaptor instead of holding one copy each. This saves memory
+     * and copying time for large collections of single parameters. Note that
+     * adaptions of the stored objects will then modify the common adaptor (e.g.
+     * its step width), just as for the values of a GDoubleCollection, which share
+     * a single adaptor as well. Objects added later on will join the groups
+     * when the collection is copied or loaded, or when this function is called
+     * again. Note also that each stored object still calls the adaptor on its
+     * own. Self-adaption of the adaption probability (see GAdaptorT<>::setAdaptAdProb())
+     * thus happens once per member and adaption of the collection, rather than
+     * once per collection as for a GDoubleCollection. The random walk of the
+     * adaption probability then takes one step per group member. Dividing
+     * adaptAdProb by the square root of the group size yields the same spread
+     * per adaption of the collection.
+     *
+     * @param shareAdaptors Indicates whether adaptors should be shared
+     */
+    void setShareAdaptors(bool shareAdaptors) {
+        m_shareAdaptors = shareAdaptors;
+
+        if (m_shareAdaptors) {
+            this->groupAdaptors();
+        } else {
+            for (auto const &item_ptr: *this) {
+                item_ptr->leaveAdaptorGroup();
+            }
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * Allows to check whether the stored objects share their adaptors
+     *
+     * @return A boolean indicating whether the stored objects share their adaptors
+     */
+    bool getShareAdaptors() const {
+        return m_shareAdaptors;
+    }
+
     /***************************************************************************/
     /**
      * Converts the local data to a boost::property_tree node
@@ -204,6 +267,70 @@ protected:
         // Load our parent class'es data ...
         GParameterBase::load_(cp);
         Gem::Common::GPtrVectorT<T, Gem::Geneva::GObject>::operator=(*p_load);
+
+        // ... and then our local data
+        m_shareAdaptors = p_load->m_shareAdaptors;
+        if (m_shareAdaptors) {
+            this->groupAdaptors();
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * Adds the size of the collection and the structure of all stored objects
+     * to the fingerprint (see GParameterBase::addToFingerprint())
+     *
+     * @param seed The fingerprint to which the description should be added
+     */
+    void fingerprint_(std::size_t &seed) const override {
+        GParameterBase::fingerprint_(seed);
+        boost::hash_combine(seed, this->size());
+        for (const auto &item_ptr: *this) {
+            item_ptr->addToFingerprint(seed);
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * Adds the objects stored in this collection to the list of objects holding
+     * parameter values (see GParameterBase::collectLeaves())
+     *
+     * @param leaves The list to which objects holding parameter values should be added
+     */
+    void collectLeaves_(std::vector<const GParameterBase *> &leaves) const override {
+        for (const auto &item_ptr: *this) {
+            item_ptr->collectLeaves(leaves);
+        }
+    }
+
+    /***************************************************************************/
+    /**
+     * Loads the data of another object of identical type and structure
+     * (see GParameterBase::loadValues()). Collections of differing size
+     * are loaded in the usual way.
+     *
+     * @param cp Another object of identical type and structure
+     */
+    void loadValues_(const GParameterBase &cp) override {
+        // Identical types are guaranteed by GParameterBase::loadValues()
+        const GParameterTCollectionT<T>& p_load = static_cast<const GParameterTCollectionT<T>&>(cp);
+
+        // Load our parent class'es data ...
+        GParameterBase::loadValues_(cp);
+
+        // ... and then our local data
+        if (this->size() != p_load.size()) {
+            Gem::Common::GPtrVectorT<T, Gem::Geneva::GObject>::operator=(p_load);
+        } else {
+            for (std::size_t i = 0; i < this->size(); i++) {
+                this->at(i)->loadValues(*(p_load.at(i)));
+            }
+        }
+
+        m_shareAdaptors = p_load.m_shareAdaptors;
+        if (m_shareAdaptors) {
+            this->groupAdaptors();
+        }
     }
 
     /***************************************************************************/
@@ -255,6 +382,7 @@ protected:
                      , p_load->m_data_cnt)
             , token
         );
+        compare_t(IDENTITY(m_shareAdaptors, p_load->m_shareAdaptors), token);
 
         // React on deviations from the expectation
         token.evaluate();
@@ -1364,7 +1492,8 @@ private:
     /**
      * Allows to adapt the values stored in this class. We assume here that
      * each item has its own adapt function. Hence we do not need to use or
-     * store own adaptors.
+     * store own adaptors. Items sharing an adaptor (see setShareAdaptors())
+     * each apply the common adaptor in turn.
      *
      * @return The number of adaptions that were carried out
      */
@@ -1428,6 +1557,34 @@ private:
     bool isIndividualParameter_() const override {
         return false;
     }
+
+    /***************************************************************************/
+    /**
+     * Lets all stored objects with identical parameter and adaptor types join
+     * a common adaptor group (see GParameterBase::startAdaptorGroup()). The
+     * first object of each kind starts a new group.
+     */
+    void groupAdaptors() {
+        std::vector<GParameterBase *> leaders;
+        for (auto const &item_ptr: *this) {
+            bool joined = false;
+            for (auto leader_ptr: leaders) {
+                if (item_ptr->joinAdaptorGroup(*leader_ptr)) {
+                    joined = true;
+                    break;
+                }
+            }
+
+            if (not joined && item_ptr->startAdaptorGroup()) {
+                leaders.push_back(item_ptr.get());
+            }
+        }
+    }
+
+    /***************************************************************************/
+    // Data
+
+    bool m_shareAdaptors = false; ///< Indicates whether the stored objects share their adaptors
 };
 
 /******************************************************************************/
@@ -1455,4 +1612,18 @@ struct is_abstract<const Gem::Geneva::GParameterTCollectionT<T>> :
 }
 
 /******************************************************************************/
+// The version of GParameterTCollectionT<>. This is the content of BOOST_CLASS_VERSION(T, 1)
+
+namespace boost {
+namespace serialization {
+template<typename T>
+struct version<Gem::Geneva::GParameterTCollectionT<T>> {
+	typedef mpl::int_<1> type;
+	typedef mpl::integral_c_tag tag;
+	BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+}
+}
+
+/******************************************************************************/
 
@@ -44,7 +44,11 @@
 #include <string>
 
 // Boost headers go here
+#include <boost/version.hpp>
 #include <boost/serialization/serialization.hpp> // See last comment at https://svn.boost.org/trac/boost/ticket/12126 . Fixes "sole" inclusion of set.hpp
+#if BOOST_VERSION >= 107400
+#include <boost/serialization/library_version_type.hpp> // set.hpp of Boost 1.74 uses library_version_type without including it
+#endif
 #include <boost/serialization/set.hpp>
 
 // Geneva headers go here
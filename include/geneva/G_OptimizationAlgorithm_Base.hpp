@@ -47,6 +47,7 @@
 #include <utility>
 
 // Boost header files go here
+#include <boost/serialization/version.hpp>
 
 // Geneva headers go here
 #include "common/GPtrVectorT.hpp"
@@ -186,7 +187,7 @@ private:
     friend class boost::serialization::access;
 
     template<typename Archive>
-    void load(Archive &ar, const unsigned int) {
+    void load(Archive &ar, const unsigned int version) {
         using boost::serialization::make_nvp;
 
         std::string cpDir{};
@@ -229,12 +230,16 @@ private:
         & BOOST_SERIALIZATION_NVP(m_default_execMode)
         & BOOST_SERIALIZATION_NVP(m_default_executor_config);
 
+        if(version > 0) {
+            ar & BOOST_SERIALIZATION_NVP(m_reproducibleSeed);
+        }
+
         // Transfer the string to the path
         m_cp_directory_path = std::filesystem::path(cpDir);
     }
 
     template<typename Archive>
-    void save(Archive &ar, const unsigned int) const {
+    void save(Archive &ar, const unsigned int version) const {
         using boost::serialization::make_nvp;
 
         // Transfer the path to the string
@@ -277,6 +282,10 @@ private:
         & BOOST_SERIALIZATION_NVP(m_executor_ptr)
         & BOOST_SERIALIZATION_NVP(m_default_execMode)
         & BOOST_SERIALIZATION_NVP(m_default_executor_config);
+
+        if(version > 0) {
+            ar & BOOST_SERIALIZATION_NVP(m_reproducibleSeed);
+        }
     }
 
     BOOST_SERIALIZATION_SPLIT_MEMBER()
@@ -427,6 +436,11 @@ public:
     /** @brief Returns the number of iterations after which the algorithm should report about its inner state. */
     G_API_GENEVA std::uint32_t getReportIteration() const;
 
+    /** @brief Sets the seed of reproducible random streams (0 disables reproducible mode) */
+    G_API_GENEVA void setReproducibleSeed(std::uint64_t seed);
+    /** @brief Retrieves the seed of reproducible random streams */
+    G_API_GENEVA std::uint64_t getReproducibleSeed() const;
+
     /** @brief Retrieves the current number of failed optimization attempts */
     G_API_GENEVA std::uint32_t getStallCounter() const;
 
@@ -483,6 +497,11 @@ public:
     /** @brief If individuals have been stored in this population, they are added to the priority queue. */
     G_API_GENEVA void addCleanStoredBests(GParameterSetFixedSizePriorityQueue &bestIndividuals);
 
+    /** @brief Positions an individual's random stream for adaption in reproducible mode */
+    G_API_GENEVA void markRandomStream(GParameterSet& ind, std::size_t pos) const;
+    /** @brief Positions an individual's random stream for random initialization in reproducible mode */
+    G_API_GENEVA void markRandomInitStream(GParameterSet& ind, std::size_t pos) const;
+
     /** @brief Helper function that determines whether we are currently inside of the first iteration */
     G_API_GENEVA bool inFirstIteration() const;
     /** @brief Helper function that determines whether we are after the first iteration */
@@ -495,8 +514,8 @@ protected:
     /***************************************************************************/
     // Some data
 
-    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY>
-        m_gr; ///< A random number generator. Note that the actual calculation is done in a random number proxy / factory
+    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>
+        m_gr; ///< A random number generator. Note that the actual calculation is done in a random number proxy / factory, unless a reproducible seed was set
     std::uniform_real_distribution<double>
         m_uniform_real_distribution; ///< Access to uniformly distributed double random values
 
@@ -688,6 +707,7 @@ private:
     std::uint32_t m_maxIteration = DEFAULTMAXIT; ///< The maximum number of iterations
     std::uint32_t m_maxStallIteration = DEFAULTMAXSTALLIT; ///< The maximum number of generations without improvement, after which optimization is stopped
     std::uint32_t m_reportIteration = DEFAULTREPORTITER; ///< The number of generations after which a report should be issued
+    std::uint64_t m_reproducibleSeed = DEFAULTREPRODUCIBLESEED; ///< The seed of reproducible random streams; 0 means "not reproducible"
 
     std::size_t m_nRecordbestGlobalIndividuals = DEFNRECORDBESTINDIVIDUALS; ///< Indicates the number of best individuals to be recorded/updated in each iteration
     GParameterSetFixedSizePriorityQueue m_bestGlobalIndividuals_pq{m_nRecordbestGlobalIndividuals}; ///< A priority queue with the best individuals found so far
@@ -751,6 +771,7 @@ private:
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT(Gem::Geneva::GBasePluggableOM)
 BOOST_SERIALIZATION_ASSUME_ABSTRACT(Gem::Geneva::G_OptimizationAlgorithm_Base)
+BOOST_CLASS_VERSION(Gem::Geneva::G_OptimizationAlgorithm_Base, 1)
 
 BOOST_CLASS_EXPORT_KEY(Gem::Courtier::GBrokerExecutorT<Gem::Geneva::GParameterSet>)
 BOOST_CLASS_EXPORT_KEY(Gem::Courtier::GSerialExecutorT<Gem::Geneva::GParameterSet>)
@@ -143,6 +143,9 @@ public:
     /** @brief Allows to retrieve the likelihood for amalgamation of two units to be performed instead of "just" duplication. */
     G_API_GENEVA double getAmalgamationLikelihood() const;
 
+    /** @brief Retrieves the number of individuals currently held for re-use */
+    G_API_GENEVA std::size_t getNRecycledIndividuals() const;
+
     /***************************************************************************/
     /**
      * Retrieves a specific parent individual and casts it to the desired type. Note that this
@@ -242,6 +245,11 @@ protected:
     /** @brief Increases the population size if requested by the user */
     G_API_GENEVA void performScheduledPopulationGrowth();
 
+    /** @brief Removes surplus individuals from the population, keeping them for later re-use */
+    G_API_GENEVA void recycleSurplusIndividuals(std::size_t nominalSize);
+    /** @brief Attaches a copy of an individual to the population, re-using recycled individuals if possible */
+    G_API_GENEVA void push_back_recycled(std::shared_ptr<GParameterSet> item_ptr);
+
     /** @brief This function implements the RANDOMDUPLICATIONSCHEME scheme */
     G_API_GENEVA void randomRecombine(std::shared_ptr<GParameterSet> &child);
     /** @brief  This function implements the VALUEDUPLICATIONSCHEME scheme */
@@ -307,6 +315,7 @@ private:
     // Data
 
     std::uniform_int_distribution<std::size_t> m_uniform_int_distribution; ///< Access to uniformly distributed random numbers
+    std::vector<std::shared_ptr<GParameterSet>> m_recycling_bin; ///< Individuals removed during selection, kept for re-use during the optimization cycle
 
     /***************************************************************************/
 };
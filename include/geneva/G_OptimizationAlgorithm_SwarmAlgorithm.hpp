@@ -295,6 +295,10 @@ protected:
 
 	 std::vector<std::shared_ptr<GParameterSet>> m_last_iteration_individuals_cnt; ///< A temporary copy of the last iteration's individuals
 
+	 std::vector<double> m_personal_best_scratch_cnt = std::vector<double>(); ///< Scratch space for personal best distances; neither copied nor serialized
+	 std::vector<double> m_nbh_best_scratch_cnt = std::vector<double>(); ///< Scratch space for neighborhood best distances; neither copied nor serialized
+	 std::vector<double> m_glb_best_scratch_cnt = std::vector<double>(); ///< Scratch space for global best distances; neither copied nor serialized
+
 private:
 	 /***************************************************************************/
 	 // Virtual or overridden private functions
@@ -74,9 +74,10 @@ std::shared_ptr<GAdaptorT<T>> getDefaultAdaptor() {
 	return std::shared_ptr<GAdaptorT<T>>();
 }
 
-// Specializations for double, std::int32_t and bool
+// Specializations for double, float, std::int32_t and bool
 /******************************************************************************/
 template <> G_API_GENEVA std::shared_ptr<GAdaptorT<double>> getDefaultAdaptor<double>();
+template <> G_API_GENEVA std::shared_ptr<GAdaptorT<float>> getDefaultAdaptor<float>();
 template <> G_API_GENEVA std::shared_ptr<GAdaptorT<std::int32_t>> getDefaultAdaptor<std::int32_t>();
 template <> G_API_GENEVA std::shared_ptr<GAdaptorT<bool>> getDefaultAdaptor<bool>();
 
@@ -83,6 +83,9 @@ const bool GO2_DEF_CLIENTMODE=false;
 const execMode GO2_DEF_DEFAULPARALLELIZATIONMODE=execMode::MULTITHREADED;
 const bool GO2_DEF_COPYBESTONLY=true;
 const std::uint16_t GO2_DEF_NPRODUCERTHREADS=0;
+const std::size_t GO2_DEF_RNFARRAYSIZE=Gem::Hap::DEFAULTARRAYSIZE;
+const std::size_t GO2_DEF_RNFBUFFERSIZE=Gem::Hap::DEFAULTFACTORYBUFFERSIZE;
+const bool GO2_DEF_RNFHUGEPAGES=Gem::Hap::DEFAULTFACTORYHUGEPAGES;
 const std::uint32_t GO2_DEF_OFFSET=0;
 const std::string GO2_DEF_OPTALGS{""}; // NOLINT
 const std::string GO2_DEF_NOCONSUMER{"none"}; // NOLINT
@@ -90,7 +93,7 @@ const bool GO2_DEF_COPYBESTINDIVIDUALSONLY=true;
 
 /******************************************************************************/
 /** @brief Set a number of parameters of the random number factory */
-G_API_GENEVA void setRNFParameters(std::uint16_t);
+G_API_GENEVA void setRNFParameters(std::uint16_t, std::size_t, std::size_t, bool);
 
 /******************************************************************************/
 /** Syntactic sugar -- make the code easier to read */
@@ -156,6 +159,9 @@ public:
 	 G_API_GENEVA bool getClientMode() const;
 
 	 G_API_GENEVA std::uint16_t getNProducerThreads() const;
+	 G_API_GENEVA std::size_t getRNFArraySize() const;
+	 G_API_GENEVA std::size_t getRNFBufferSize() const;
+	 G_API_GENEVA bool getRNFUseHugePages() const;
 
 	 G_API_GENEVA void setOffset(std::uint32_t);
 	 G_API_GENEVA std::uint32_t getIterationOffset() const;
@@ -231,6 +237,12 @@ private:
 	 /***************************************************************************/
 	 /** @brief Sets the number of random number production threads */
 	 void setNProducerThreads(std::uint16_t);
+	 /** @brief Sets the number of random numbers in each package of the random number factory */
+	 void setRNFArraySize(std::size_t);
+	 /** @brief Sets the number of packages held in the buffers of the random number factory */
+	 void setRNFBufferSize(std::size_t);
+	 /** @brief Specifies whether large random number packages should be backed by huge pages */
+	 void setRNFUseHugePages(bool);
 
 	 /** @brief Perform the actual optimization cycle */
 	 G_API_GENEVA Go2 const * const optimize_(std::uint32_t) final;
@@ -248,6 +260,9 @@ private:
 	 //---------------------------------------------------------------------------
 	 // Parameters for the random number generator
 	 std::uint16_t m_n_producer_threads = GO2_DEF_NPRODUCERTHREADS; ///< The number of threads that will simultaneously produce random numbers
+	 std::size_t m_rnf_array_size = GO2_DEF_RNFARRAYSIZE; ///< The number of random numbers in each package of the random number factory
+	 std::size_t m_rnf_buffer_size = GO2_DEF_RNFBUFFERSIZE; ///< The number of packages held in the buffers of the random number factory
+	 bool m_rnf_use_huge_pages = GO2_DEF_RNFHUGEPAGES; ///< Whether large random number packages should be backed by huge pages
 
 	 //---------------------------------------------------------------------------
 	 // Parameters for clients
@@ -0,0 +1,178 @@
+/**
+ * @file GRecombination_tests.hpp
+ *
+ * Tests of the recombination of individuals in parent/child algorithms
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <filesystem>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "geneva/G_OptimizationAlgorithm_EvolutionaryAlgorithm.hpp"
+#include "geneva/GParameterSet.hpp"
+#include "geneva/GDoubleCollection.hpp"
+#include "geneva/GDoubleGaussAdaptor.hpp"
+
+namespace Gem {
+namespace Geneva {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * A simple parabola individual that counts how often it is copied
+ */
+class GCopyCountingIndividual
+	: public GParameterSet
+{
+public:
+	 /** @brief The default constructor */
+	 GCopyCountingIndividual()
+		 : GParameterSet()
+	 {
+		 std::shared_ptr<GDoubleCollection> gdc_ptr(new GDoubleCollection(100, -10., 10.));
+		 gdc_ptr->addAdaptor(std::shared_ptr<GDoubleGaussAdaptor>(new GDoubleGaussAdaptor(0.025, 0.1, 0., 1.)));
+		 this->push_back(gdc_ptr);
+	 }
+
+	 /** @brief The copy constructor; counts the copies made */
+	 GCopyCountingIndividual(const GCopyCountingIndividual& cp)
+		 : GParameterSet(cp)
+	 {
+		 nCopies()++;
+	 }
+
+	 /** @brief The destructor */
+	 ~GCopyCountingIndividual() override = default;
+
+	 /** @brief The number of copies made of any object of this class so far */
+	 static std::atomic<std::size_t>& nCopies() {
+		 static std::atomic<std::size_t> n{0};
+		 return n;
+	 }
+
+protected:
+	 /** @brief A simple parabola */
+	 double fitnessCalculation() override {
+		 std::vector<double> parVec;
+		 this->streamline(parVec);
+
+		 double result = 0.;
+		 for(auto const& par: parVec) {
+			 result += par*par;
+		 }
+		 return result;
+	 }
+
+private:
+	 /** @brief Creates a deep clone of this object */
+	 GObject *clone_() const override {
+		 return new GCopyCountingIndividual(*this);
+	 }
+};
+
+/******************************************************************************/
+/**
+ * Checks the recombination of individuals in optimization runs
+ */
+class GRecombination_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 std::filesystem::path executorConfig
+			 = std::filesystem::temp_directory_path() / "GRecombination_tests_GSerialExecutor.json";
+		 bool configExisted = std::filesystem::exists(executorConfig);
+
+		 const std::size_t popSize = 20, nParents = 2;
+		 const std::uint32_t maxIteration = 10;
+
+		 // Runs an evolutionary algorithm and returns the number of individuals copied during the run
+		 auto nCopiesDuringRun = [&](double amalgamationLikelihood) -> std::size_t {
+			 GEvolutionaryAlgorithm ea;
+			 ea.registerExecutor(execMode::SERIAL, executorConfig);
+			 ea.setPopulationSizes(popSize, nParents);
+			 ea.setMaxIteration(maxIteration);
+			 ea.setAmalgamationLikelihood(amalgamationLikelihood);
+			 ea.push_back(std::shared_ptr<GCopyCountingIndividual>(new GCopyCountingIndividual()));
+
+			 std::size_t nCopiesBefore = GCopyCountingIndividual::nCopies();
+			 ea.optimize();
+			 return GCopyCountingIndividual::nCopies() - nCopiesBefore;
+		 };
+
+		 //----------------------------------------------------------------------
+
+		 { // Children created through cross-over do not require copies of their parents
+			 std::size_t nDuplicationCopies = nCopiesDuringRun(0.);
+			 std::size_t nCrossOverCopies = nCopiesDuringRun(1.);
+
+			 // Cross-over through temporary copies would add one copy per child and iteration
+			 BOOST_CHECK_MESSAGE(
+				 nCrossOverCopies < nDuplicationCopies + (popSize - nParents) * maxIteration / 2
+				 , "\n"
+				 << "nDuplicationCopies = " << nDuplicationCopies << "\n"
+				 << "nCrossOverCopies = " << nCrossOverCopies << "\n"
+			 );
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 if(not configExisted) std::filesystem::remove(executorConfig);
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Geneva */
+} /* namespace Gem */
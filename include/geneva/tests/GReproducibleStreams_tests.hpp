@@ -0,0 +1,125 @@
+/**
+ * @file GReproducibleStreams_tests.hpp
+ *
+ * Tests of reproducible random streams in optimization algorithms
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <vector>
+#include <memory>
+#include <filesystem>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "geneva/G_OptimizationAlgorithm_EvolutionaryAlgorithm.hpp"
+#include "geneva/GTestIndividual1.hpp"
+
+namespace Gem {
+namespace Geneva {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Checks that optimization runs with a reproducible seed do not depend on
+ * the number of adaption threads
+ */
+class GReproducibleStreams_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 std::filesystem::path executorConfig
+			 = std::filesystem::temp_directory_path() / "GReproducibleStreams_tests_GSerialExecutor.json";
+		 bool configExisted = std::filesystem::exists(executorConfig);
+
+		 // All runs start from the same individual
+		 std::shared_ptr<Gem::Tests::GTestIndividual1> start_ptr(new Gem::Tests::GTestIndividual1());
+
+		 // Runs an evolutionary algorithm and returns the parameters and fitness of the best individual
+		 auto run = [&](std::uint16_t nThreads, std::uint64_t seed) -> std::vector<double> {
+			 GEvolutionaryAlgorithm ea;
+			 ea.registerExecutor(execMode::SERIAL, executorConfig);
+			 ea.setNThreads(nThreads);
+			 ea.setReproducibleSeed(seed);
+			 ea.setPopulationSizes(20, 2);
+			 ea.setMaxIteration(10);
+			 ea.push_back(start_ptr->clone<GParameterSet>());
+
+			 ea.optimize();
+
+			 std::vector<double> result;
+			 auto best_ptr = ea.getBestGlobalIndividual<GParameterSet>();
+			 best_ptr->streamline(result);
+			 result.push_back(best_ptr->raw_fitness(0));
+			 return result;
+		 };
+
+		 //----------------------------------------------------------------------
+
+		 { // The same seed gives bit-identical results with one and several adaption threads
+			 std::vector<double> single = run(1, 4711);
+			 std::vector<double> multi = run(8, 4711);
+			 std::vector<double> other = run(8, 4712);
+
+			 BOOST_REQUIRE(not single.empty());
+			 BOOST_CHECK(single == multi);
+			 BOOST_CHECK(single != other);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 if(not configExisted) std::filesystem::remove(executorConfig);
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Geneva */
+} /* namespace Gem */
@@ -0,0 +1,167 @@
+/**
+ * @file GValidityChecks_tests.hpp
+ *
+ * Tests of reproducible random streams in optimization algorithms
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <vector>
+#include <memory>
+#include <filesystem>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "geneva/GParameterSetMultiConstraint.hpp"
+#include "geneva/GDoubleObject.hpp"
+#include "geneva/GDoubleCollection.hpp"
+#include "geneva/GTestIndividual1.hpp"
+
+namespace Gem {
+namespace Geneva {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Checks the validity checks applied to individuals prior to their evaluation
+ */
+class GValidityChecks_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 // Creates an individual with a collection "x" of 100 values and an object "y"
+		 auto create = []() -> std::shared_ptr<Gem::Tests::GTestIndividual1> {
+			 std::shared_ptr<Gem::Tests::GTestIndividual1> ind_ptr(new Gem::Tests::GTestIndividual1());
+			 ind_ptr->at<GDoubleCollection>(0)->setParameterName("x");
+			 std::shared_ptr<GDoubleObject> y_ptr(new GDoubleObject(3.));
+			 y_ptr->setParameterName("y");
+			 ind_ptr->push_back(y_ptr);
+			 return ind_ptr;
+		 };
+
+		 //----------------------------------------------------------------------
+
+		 { // The formula's variables are mapped to the right values, also after changes of the structure
+			 // The formula's results are kept above 1, so check() returns them unchanged
+			 GParameterSetFormulaConstraint constraint("{{x[2]}} + 2*{{y}} + 100");
+
+			 auto ind_ptr = create();
+			 double x2 = ind_ptr->at<GDoubleCollection>(0)->at(2);
+			 BOOST_CHECK_CLOSE(constraint.check(ind_ptr.get()), x2 + 106., 1e-8);
+
+			 // Changed values are picked up with the same slot positions
+			 ind_ptr->at<GDoubleObject>(1)->setValue(4.);
+			 BOOST_CHECK_CLOSE(constraint.check(ind_ptr.get()), x2 + 108., 1e-8);
+
+			 // Moving the parameter objects requires new slot positions
+			 std::shared_ptr<GDoubleObject> z_ptr(new GDoubleObject(5.));
+			 z_ptr->setParameterName("z");
+			 ind_ptr->insert(ind_ptr->begin(), z_ptr);
+			 BOOST_CHECK_CLOSE(constraint.check(ind_ptr.get()), x2 + 108., 1e-8);
+
+			 // With several objects of the same name, the last one takes precedence
+			 std::shared_ptr<GDoubleObject> y2_ptr(new GDoubleObject(-1.));
+			 y2_ptr->setParameterName("y");
+			 ind_ptr->push_back(y2_ptr);
+			 BOOST_CHECK_CLOSE(constraint.check(ind_ptr.get()), x2 + 98., 1e-8);
+
+			 // Switching back to the original structure works as well
+			 auto ind2_ptr = create();
+			 double x2_2 = ind2_ptr->at<GDoubleCollection>(0)->at(2);
+			 BOOST_CHECK_CLOSE(constraint.check(ind2_ptr.get()), x2_2 + 106., 1e-8);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Individuals with the same layout but different parameter names are told apart
+			 GParameterSetFormulaConstraint constraint("{{x}} + 2*{{y}} + 100");
+
+			 auto ind_ptr = create();
+			 double x0 = ind_ptr->at<GDoubleCollection>(0)->at(0);
+			 BOOST_CHECK_CLOSE(constraint.check(ind_ptr.get()), x0 + 106., 1e-8);
+
+			 auto renamed_ptr = create();
+			 renamed_ptr->at<GDoubleCollection>(0)->setParameterName("y");
+			 renamed_ptr->at<GDoubleObject>(1)->setParameterName("x");
+			 double y0 = renamed_ptr->at<GDoubleCollection>(0)->at(0);
+			 BOOST_CHECK_CLOSE(constraint.check(renamed_ptr.get()), 3. + 2.*y0 + 100., 1e-8);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to fail
+	  */
+	 void failures_expected() {
+		 // The exceptions are logged to a file, which we remove again if it did not exist before
+		 std::filesystem::path exception_log("./GENEVA-EXCEPTION.log");
+		 bool log_existed = std::filesystem::exists(exception_log);
+
+		 { // Place holders without matching parameter objects are rejected
+			 std::shared_ptr<Gem::Tests::GTestIndividual1> ind_ptr(new Gem::Tests::GTestIndividual1());
+			 ind_ptr->at<GDoubleCollection>(0)->setParameterName("x");
+
+			 GParameterSetFormulaConstraint unknown("{{w}}");
+			 BOOST_CHECK_THROW(unknown.check(ind_ptr.get()), gemfony_exception);
+
+			 GParameterSetFormulaConstraint outOfRange("{{x[100]}}");
+			 BOOST_CHECK_THROW(outOfRange.check(ind_ptr.get()), gemfony_exception);
+		 }
+
+		 if(not log_existed) std::filesystem::remove(exception_log);
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Geneva */
+} /* namespace Gem */
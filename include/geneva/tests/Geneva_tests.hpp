@@ -415,3 +415,48 @@ BOOST_TEST_CASE_TEMPLATE_FUNCTION( StandardTests_failures_expected, T){
 }
 
 /*************************************************************************************************/
+
+/**
+ * This function checks that loadValues() transfers the same data as load() for parameter
+ * types (i.e. GParameterBase derivatives). Classes with local data need to re-implement
+ * loadValues_() together with load_(). Their data would otherwise be skipped.
+ */
+BOOST_TEST_CASE_TEMPLATE_FUNCTION( StandardTests_loadValues, T){
+	// Prepare printing of error messages in object comparisons
+	GEqualityPrinter gep(
+		"StandardTests_loadValues"
+		, pow(10,-10)
+		, Gem::Common::CE_WITH_MESSAGES
+	);
+
+	std::shared_ptr<T> T_ptr = TFactory_GUnitTests<T>();
+	BOOST_REQUIRE(T_ptr); // must point somewhere
+	BOOST_REQUIRE_NO_THROW(T_ptr->modify_GUnitTests());
+
+	// Both targets share the structure of the original object
+	std::shared_ptr<T> T_ptr_values = T_ptr->GObject::template clone<T>();
+	std::shared_ptr<T> T_ptr_load = T_ptr->GObject::template clone<T>();
+
+	// Modify the original object once more, so that it differs from the targets
+	if(T_ptr->modify_GUnitTests()) {
+		std::size_t fingerprint = 0, fingerprint_values = 0;
+		T_ptr->addToFingerprint(fingerprint);
+		T_ptr_values->addToFingerprint(fingerprint_values);
+
+		if(fingerprint == fingerprint_values) {
+			BOOST_CHECK(gep.isInEqual(*T_ptr_values, *T_ptr));
+
+			BOOST_REQUIRE_NO_THROW(T_ptr_values->loadValues(*T_ptr));
+			BOOST_REQUIRE_NO_THROW(T_ptr_load->GObject::load(*T_ptr));
+
+			BOOST_CHECK(gep.isEqual(*T_ptr_values, *T_ptr));
+			BOOST_CHECK(gep.isEqual(*T_ptr_values, *T_ptr_load));
+		} else {
+			std::cout << "loadValues() test for object with name " << typeid(T).name() << " not run because the structure has changed" << std::endl;
+		}
+	} else {
+		std::cout << "loadValues() test for object with name " << typeid(T).name() << " not run because original objects are identical" << std::endl;
+	}
+}
+
+/*************************************************************************************************/
@@ -68,6 +68,8 @@ const double DEF_BINORM_DISTANCE=0.5;
 enum class RANDFLAVOURS : Gem::Common::ENUMBASETYPE {
 	RANDOMPROXY = 0 // random numbers are taken from the factory
 	, RANDOMLOCAL = 1 // random numbers are produced locally, using a seed taken from the seed manager or provided to the constructor
+	, RANDOMCOUNTER = 2 // random numbers are produced in place by a counter-based generator, keyed by (seed, stream)
+	, RANDOMSTREAM = 3 // random numbers are taken from the factory, unless a counter-based stream was selected with reseed()
 };
 
 /******************************************************************************/
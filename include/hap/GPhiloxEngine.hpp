@@ -0,0 +1,226 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <cstdint>
+#include <array>
+#include <limits>
+
+// Boost headers go here
+
+// Geneva headers go here
+
+namespace Gem {
+namespace Hap {
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * A counter-based random number engine implementing Philox4x32-10 (Salmon et al.,
+ * "Parallel Random Numbers: As Easy as 1, 2, 3", SC11). Each output block of four
+ * 32 bit numbers is a bijective function of a 128 bit counter and a 64 bit key.
+ * The key is derived from a seed, the upper half of the counter from a stream id,
+ * the lower half simply counts the blocks produced. Engines with different
+ * (seed, stream) pairs thus produce independent sequences without any shared
+ * state, and positioning inside a stream is O(1). The class models the
+ * C++11 UniformRandomBitGenerator interface, so it may be used with the
+ * std:: distributions.
+ */
+class philox4x32 {
+public:
+	 using result_type = std::uint32_t;
+
+	 /***************************************************************************/
+	 /**
+	  * Initialization with a seed and a stream id
+	  *
+	  * @param seed The seed, used as the key of the block function
+	  * @param stream The id of the stream inside of the key's sequence
+	  */
+	 explicit philox4x32(
+		 std::uint64_t seed = 0
+		 , std::uint64_t stream = 0
+	 ) noexcept {
+		 this->seed(seed, stream);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Resets the engine to the start of the stream identified by (seed, stream)
+	  */
+	 void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept {
+		 m_key = {{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}};
+		 m_stream = stream;
+		 m_block = 0;
+		 m_pos = 4; // forces generation of a new block upon the first call
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Returns the next 32 bit random number
+	  */
+	 result_type operator()() noexcept {
+		 if(m_pos >= 4) {
+			 m_out = block(m_block++);
+			 m_pos = 0;
+		 }
+		 return m_out[m_pos++];
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Skips n numbers in O(1)
+	  */
+	 void discard(std::uint64_t n) noexcept {
+		 std::uint64_t remaining = 4 - m_pos;
+		 if(n < remaining) {
+			 m_pos += static_cast<std::uint32_t>(n);
+			 return;
+		 }
+
+		 n -= remaining;
+		 m_block += n / 4;
+		 m_out = block(m_block++);
+		 m_pos = static_cast<std::uint32_t>(n % 4);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates the output block for a given block index of this stream. This
+	  * does not change the state of the engine.
+	  */
+	 std::array<std::uint32_t, 4> block(std::uint64_t index) const noexcept {
+		 return philox4x32::bijection(
+			 {{
+				 static_cast<std::uint32_t>(index)
+				 , static_cast<std::uint32_t>(index >> 32)
+				 , static_cast<std::uint32_t>(m_stream)
+				 , static_cast<std::uint32_t>(m_stream >> 32)
+			 }}
+			 , m_key
+		 );
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * The raw Philox4x32-10 block function
+	  */
+	 static std::array<std::uint32_t, 4> bijection(
+		 std::array<std::uint32_t, 4> ctr
+		 , std::array<std::uint32_t, 2> key
+	 ) noexcept {
+		 for(std::size_t r=0; r<PHILOXROUNDS; r++) {
+			 if(r > 0) {
+				 key[0] += PHILOXW0;
+				 key[1] += PHILOXW1;
+			 }
+
+			 const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOXM0) * ctr[0];
+			 const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOXM1) * ctr[2];
+
+			 ctr = {{
+				 static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0]
+				 , static_cast<std::uint32_t>(p1)
+				 , static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1]
+				 , static_cast<std::uint32_t>(p0)
+			 }};
+		 }
+
+		 return ctr;
+	 }
+
+	 /***************************************************************************/
+	 /** @brief The smallest value returned by this engine */
+	 static constexpr result_type (min)() {
+		 return (std::numeric_limits<result_type>::min)();
+	 }
+
+	 /** @brief The largest value returned by this engine */
+	 static constexpr result_type (max)() {
+		 return (std::numeric_limits<result_type>::max)();
+	 }
+
+	 /***************************************************************************/
+	 /** @brief Checks for equality with another engine, i.e. same stream and same position */
+	 bool operator==(const philox4x32& other) const noexcept {
+		 return m_key == other.m_key && m_stream == other.m_stream && this->position() == other.position();
+	 }
+
+	 /** @brief Checks for inequality with another engine */
+	 bool operator!=(const philox4x32& other) const noexcept {
+		 return not this->operator==(other);
+	 }
+
+private:
+	 /***************************************************************************/
+	 /**
+	  * The number of values already consumed from the stream
+	  */
+	 std::uint64_t position() const noexcept {
+		 return 4*m_block + m_pos - 4;
+	 }
+
+	 /***************************************************************************/
+	 // Constants of the Philox4x32-10 block function
+
+	 static constexpr std::size_t PHILOXROUNDS = 10;
+	 static constexpr std::uint32_t PHILOXM0 = 0xD2511F53;
+	 static constexpr std::uint32_t PHILOXM1 = 0xCD9E8D57;
+	 static constexpr std::uint32_t PHILOXW0 = 0x9E3779B9;
+	 static constexpr std::uint32_t PHILOXW1 = 0xBB67AE85;
+
+	 /***************************************************************************/
+	 // Data
+
+	 std::array<std::uint32_t, 2> m_key{{0, 0}}; ///< The key, derived from the seed
+	 std::uint64_t m_stream = 0; ///< The id of the stream, forms the upper half of the counter
+	 std::uint64_t m_block = 0; ///< The index of the next block to be calculated
+	 std::array<std::uint32_t, 4> m_out{{0, 0, 0, 0}}; ///< The current output block
+	 std::uint32_t m_pos = 4; ///< The position of the next number to be returned from m_out
+};
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+
+} /* namespace Hap */
+} /* namespace Gem */
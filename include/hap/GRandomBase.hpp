@@ -50,6 +50,10 @@
 #include <cassert>
 #include <algorithm>
 #include <random>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <type_traits>
 
 // Boost headers go here
 #include <boost/math/constants/constants.hpp>
@@ -62,6 +66,7 @@
 #include "hap/GHapEnums.hpp"
 #include "hap/GRandomDefines.hpp"
 #include "hap/GRandomFactory.hpp"
+#include "hap/GZigguratNormalT.hpp"
 
 /******************************************************************************/
 
@@ -88,6 +93,55 @@ public:
 	 /** @brief Retrieves a "raw" random item item */
 	 G_API_HAP GRandomBase::result_type operator()();
 
+	 /** @brief Fills a range with "raw" random items */
+	 G_API_HAP void fill_raw(result_type *, std::size_t);
+	 /** @brief Fills a range with uniformly distributed double values in the range [0,1[ */
+	 G_API_HAP void fill_uniform01(double *, std::size_t);
+	 /** @brief Fills a range with uniformly distributed float values in the range [0,1[ */
+	 G_API_HAP void fill_uniform01(float *, std::size_t);
+	 /** @brief Fills a range with normally distributed double values */
+	 G_API_HAP void fill_normal(double *, std::size_t, double, double);
+	 /** @brief Fills a range with normally distributed float values */
+	 G_API_HAP void fill_normal(float *, std::size_t, float, float);
+	 /** @brief Fills a range with 0/1 values, where 1 appears with probability p */
+	 G_API_HAP void fill_bernoulli(std::uint8_t *, std::size_t, double);
+	 /** @brief Fills a range of 64 bit words with bits that are set with probability p */
+	 G_API_HAP void fill_bernoulli_words(std::uint64_t *, std::size_t, double);
+
+	 /***************************************************************************/
+	 /**
+	  * Fills a vector with uniformly distributed values in the range [0,1[
+	  */
+	 template<typename fp_type>
+	 void fill_uniform01(std::vector<fp_type>& v) {
+		 this->fill_uniform01(v.data(), v.size());
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Fills a vector with normally distributed values
+	  */
+	 template<typename fp_type>
+	 void fill_normal(std::vector<fp_type>& v, fp_type mu, fp_type sigma) {
+		 this->fill_normal(v.data(), v.size(), mu, sigma);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Fills a vector with 0/1 values, where 1 appears with probability p
+	  */
+	 void fill_bernoulli(std::vector<std::uint8_t>& v, double p) {
+		 this->fill_bernoulli(v.data(), v.size(), p);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Fills a vector of 64 bit words with bits that are set with probability p
+	  */
+	 void fill_bernoulli_words(std::vector<std::uint64_t>& v, double p) {
+		 this->fill_bernoulli_words(v.data(), v.size(), p);
+	 }
+
 	/***************************************************************************/
 	// Prevent copying
 	GRandomBase(const GRandomBase&) = delete;
@@ -121,6 +175,12 @@ private:
 	 /***************************************************************************/
 	 /** @brief Uniformly distributed integer numbers in the range min/max */
 	 virtual G_API_HAP result_type int_random() = 0;
+	 /** @brief Fills a range with uniformly distributed integer numbers; may be overloaded for bulk retrieval */
+	 virtual G_API_HAP void int_random_n(result_type *, std::size_t);
+
+	 /** @brief Common implementation of the floating point fill functions */
+	 template<typename fp_type> void fill_uniform01_(fp_type *, std::size_t);
+	 template<typename fp_type> void fill_normal_(fp_type *, std::size_t, fp_type, fp_type);
 };
 
 /******************************************************************************/
@@ -94,6 +94,38 @@ using lagged_fibonacci = std::subtract_with_carry_engine<uint_fast64_t, 48, 5, 1
 	const std::size_t   DEFAULTSEEDVECTORSIZE = 2000; ///< The size of the seeding vector
 #endif /* GENEVA_HAP_RANDOM_FACTORY_SEED_VECTOR_SIZE */
 
+/******************************************************************************/
+/**
+ * The number of raw random numbers processed in one go by the bulk
+ * functions of GRandomBase (fill_uniform01() etc.)
+ */
+const std::size_t DEFAULTBULKCHUNKSIZE = 256;
+
+/******************************************************************************/
+/**
+ * Indicates whether the storage of large random number packages should be
+ * backed by huge pages, where the operating system supports this
+ */
+const bool DEFAULTFACTORYHUGEPAGES = false;
+
+/**
+ * The alignment of the storage of random number packages (a cache line)
+ */
+const std::size_t RANDOMSTORAGEALIGNMENT = 64;
+
+/**
+ * The size and alignment of huge pages. Packages smaller than this are
+ * never backed by huge pages.
+ */
+const std::size_t RANDOMHUGEPAGESIZE = 2*1024*1024;
+
+/******************************************************************************/
+/**
+ * The number of random number packages exchanged in one go between the
+ * thread-local caches of the random number factory and its global buffers
+ */
+const std::size_t DEFAULTFACTORYCACHESIZE = 4;
+
 /******************************************************************************/
 /**
  * The number of threads that simultaneously produce [0,1[ random numbers
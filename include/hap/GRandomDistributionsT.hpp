@@ -48,6 +48,7 @@
 // Geneva headers go here
 
 #include "hap/GRandomT.hpp"
+#include "hap/GZigguratNormalT.hpp"
 #include "common/GCommonMathHelperFunctions.hpp"
 
 namespace Gem {
@@ -296,7 +297,7 @@ public:
 	}
 
 private:
-	 std::normal_distribution<fp_type> m_normal_distribution{}; ///< Needed to form each gaussian "hill" of the distribution
+	 ziggurat_normal_distribution<fp_type> m_normal_distribution{}; ///< Needed to form each gaussian "hill" of the distribution
 	 std::bernoulli_distribution m_uniform_bool{}; ///< Needed to decide whether a gaussian is created for the left or right peak
 
 	 param_type m_params {
@@ -55,6 +55,7 @@
 #include <thread>
 #include <mutex>
 #include <array>
+#include <vector>
 #include <algorithm>
 
 // Boost headers go here
@@ -82,6 +83,21 @@ using G_BASE_GENERATOR = std::mt19937;
 
 class GRandomFactory; // Forward declaration, so we can make random_container constructor private
 
+/******************************************************************************/
+/** @brief Allocates cache-line aligned (and possibly huge-page backed) storage for n random numbers */
+G_API_HAP G_BASE_GENERATOR::result_type *acquire_random_storage(std::size_t n, bool &hugePages);
+/** @brief Releases storage obtained from acquire_random_storage() */
+G_API_HAP void release_random_storage(G_BASE_GENERATOR::result_type *p) noexcept;
+
+/**
+ * A deleter for storage obtained from acquire_random_storage()
+ */
+struct random_storage_deleter {
+	 void operator()(G_BASE_GENERATOR::result_type *p) const noexcept {
+		 release_random_storage(p);
+	 }
+};
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -90,7 +106,9 @@ class GRandomFactory; // Forward declaration, so we can make random_container co
  * via a buffer. It does minimal error checking as it is meant for internal usage only,
  * and excessive error checking on the code might have strong performance implications.
  * None of the functions in this class is thread-safe (in the sense of being usable
- * concurrently from multiple threads).
+ * concurrently from multiple threads). The number of random numbers in a container
+ * is set by the factory at run-time. Storage is cache-line aligned and is reused
+ * when containers are recycled by the factory.
  */
 class random_container {
 	 friend class GRandomFactory; // Needed so we can prevent construction of containers outside of the factory
@@ -112,7 +130,7 @@ public:
 	 /***************************************************************************/
 	 /** @brief Returns the size of the buffer */
 	 std::size_t size() const {
-		 return DEFAULTARRAYSIZE;
+		 return m_size;
 	 }
 
 	 /***************************************************************************/
@@ -121,12 +139,24 @@ public:
 		 return m_current_pos;
 	 }
 
+	 /***************************************************************************/
+	 /** @brief Checks whether the storage of this container is backed by huge pages */
+	 bool isHugePageBacked() const {
+		 return m_huge_pages;
+	 }
+
+	 /***************************************************************************/
+	 /** @brief Returns the array size generation of the factory this container was filled in */
+	 std::uint64_t generation() const {
+		 return m_generation;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Allows to check whether the buffer has run empty
 	  */
 	 bool empty() const {
-		 return (m_current_pos >= DEFAULTARRAYSIZE);
+		 return (m_current_pos >= m_size);
 	 }
 
 	 /***************************************************************************/
@@ -139,7 +169,7 @@ public:
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
 					 << "In random_container::next(): Error!" << std::endl
-					 << "Invalid m_current_pos: " << m_current_pos << " / " << DEFAULTARRAYSIZE << std::endl
+					 << "Invalid m_current_pos: " << m_current_pos << " / " << m_size << std::endl
 			 );
 		 }
 #endif
@@ -147,18 +177,41 @@ public:
 		 return m_r[m_current_pos++];
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Copies up to n random numbers from the package in one go
+	  *
+	  * @param out The target of the copy operation
+	  * @param n The maximum number of items to be copied
+	  * @return The number of items actually copied
+	  */
+	 std::size_t next_n(G_BASE_GENERATOR::result_type *out, std::size_t n) {
+		 std::size_t nCopy = (std::min)(n, m_size - (std::min)(m_current_pos, m_size));
+		 std::copy(m_r.get() + m_current_pos, m_r.get() + m_current_pos + nCopy, out);
+		 m_current_pos += nCopy;
+		 return nCopy;
+	 }
+
 private:
 	 /***************************************************************************/
 	 /**
 	  * Initialization with the number of entries in the buffer
 	  *
+	  * @param size The number of random numbers held by this container
+	  * @param hugePages Indicates whether storage should be backed by huge pages, if possible
 	  * @param rng A reference to an external random number generator
 	  */
-	 explicit random_container(
-		 G_BASE_GENERATOR &rng
-	 ) {
+	 random_container(
+		 std::size_t size
+		 , bool hugePages
+		 , G_BASE_GENERATOR &rng
+	 )
+		 : m_size(size)
+		 , m_huge_pages(hugePages)
+	 {
 		 try {
-			 std::generate(m_r.begin(), m_r.end(), [&](){ return rng(); });
+			 m_r.reset(acquire_random_storage(m_size, m_huge_pages));
+			 std::generate(m_r.get(), m_r.get() + m_size, [&](){ return rng(); });
 		 } catch (const std::bad_alloc &e) {
 			 throw gemfony_exception(
 				 g_error_streamer(DO_LOG, time_and_place)
@@ -181,13 +234,16 @@ private:
 	  * pointer. T_RNG must be one of the standard C++1x-generators
 	  */
 	 void refresh(G_BASE_GENERATOR &rng) {
-		 std::generate(m_r.begin(), m_r.begin() + m_current_pos, [&](){ return rng(); });
+		 std::generate(m_r.get(), m_r.get() + (std::min)(m_current_pos, m_size), [&](){ return rng(); });
 		 m_current_pos = 0;
 	 }
 	 /***************************************************************************/
 
+	 std::size_t m_size; ///< The number of random numbers in this container
+	 bool m_huge_pages; ///< Indicates whether the storage is backed by huge pages
+	 std::uint64_t m_generation = 0; ///< The array size generation of the factory when this container was filled
 	 std::size_t m_current_pos = 0; ///< The current position in the array
-	 std::array<G_BASE_GENERATOR::result_type, DEFAULTARRAYSIZE> m_r{}; ///< Holds the actual random numbers
+	 std::unique_ptr<G_BASE_GENERATOR::result_type[], random_storage_deleter> m_r; ///< Holds the actual random numbers
 };
 
 /******************************************************************************/
@@ -207,7 +263,10 @@ private:
  *
  * This class produces packets of random numbers and stores them in bounded buffers.
  * Clients can retrieve packets of random numbers, while separate threads keep
- * filling the buffer up.
+ * filling the buffer up. Each client thread keeps a small cache of fresh and used
+ * packages, which is exchanged in bulk with the global buffers. Producers sleep
+ * until clients have drained the buffer of fresh packages. Clients never wait for
+ * producers -- if the global buffer has run empty, packages are filled locally.
  *
  * The implementation currently uses the lagged fibonacci generator. According to
  * http://www.boost.org/doc/libs/1_35_0/libs/random/random-performance.html this is
@@ -242,12 +301,21 @@ public:
 	 /** @brief Sets the number of producer threads for this factory. */
 	 G_API_HAP void setNProducerThreads(const std::uint16_t &);
 
+	 /** @brief Sets the number of random numbers in newly created packages */
+	 G_API_HAP void setArraySize(std::size_t);
 	 /** @brief Allows to retrieve the size of the array */
 	 G_API_HAP std::size_t getCurrentArraySize() const;
 
+	 /** @brief Sets the maximum number of packages held in the buffers */
+	 G_API_HAP void setBufferSize(std::size_t);
 	 /** @brief Allows to retrieve the size of the buffer */
 	 G_API_HAP std::size_t getBufferSize() const;
 
+	 /** @brief Specifies whether the storage of new packages should be backed by huge pages */
+	 G_API_HAP void setUseHugePages(bool);
+	 /** @brief Checks whether the storage of new packages should be backed by huge pages */
+	 G_API_HAP bool getUseHugePages() const;
+
 	 /** @brief Delivers a new [0,1[ random number container with the current standard size to clients */
 	 G_API_HAP std::unique_ptr <random_container> getNewRandomContainer();
 	 /** @brief Retrieval of a new seed for external or internal random number generators */
@@ -257,6 +325,25 @@ public:
 	 G_API_HAP void returnUsedPackage(std::unique_ptr<random_container>&&);
 
 private:
+	 /***************************************************************************/
+	 /**
+	  * Per-thread storage of fresh and used random number packages, so that
+	  * the global buffers are only accessed once for a batch of packages. A
+	  * local generator is used in case the global buffer has run empty.
+	  */
+	 struct thread_cache {
+		 std::vector<std::unique_ptr<random_container>> fresh; ///< Packages ready for use
+		 std::vector<std::unique_ptr<random_container>> used; ///< Packages waiting to be recycled
+		 std::unique_ptr<G_BASE_GENERATOR> gen; ///< A generator for packages filled locally
+	 };
+
+	 /** @brief Gives access to the package cache of the calling thread */
+	 static thread_cache& localCache();
+	 /** @brief Fills a package in the calling thread, if no fresh package is available */
+	 std::unique_ptr<random_container> fillLocally(thread_cache&);
+	 /** @brief Refreshes a recycled package or replaces it, if its size is outdated, and tags it with the current generation */
+	 void refill(std::unique_ptr<random_container>&, G_BASE_GENERATOR&) const;
+
 	 /** @brief The production of [0,1[ random numbers takes place here */
 	 void producer(std::uint32_t seed);
 
@@ -264,6 +351,9 @@ private:
 	 std::atomic<bool> m_threads_started = ATOMIC_VAR_INIT(false); ///< Indicates whether threads were already started
 	 std::atomic<bool> m_threads_stop_requested = ATOMIC_VAR_INIT(false); ///< Indicates whether all threads were requested to stop
 	 std::atomic<std::uint16_t> m_n_producer_threads = ATOMIC_VAR_INIT(DEFAULT01PRODUCERTHREADS); ///< The number of threads used to produce random numbers
+	 std::atomic<std::size_t> m_array_size = ATOMIC_VAR_INIT(DEFAULTARRAYSIZE); ///< The number of random numbers in newly created packages
+	 std::atomic<std::uint64_t> m_array_generation = ATOMIC_VAR_INIT(0); ///< Incremented whenever m_array_size changes, so that outdated packages can be recognized
+	 std::atomic<bool> m_use_huge_pages = ATOMIC_VAR_INIT(DEFAULTFACTORYHUGEPAGES); ///< Whether new packages should be backed by huge pages
 
 	 Gem::Common::GThreadGroup m_producer_threads; ///< A thread group that holds [0,1[ producer threads
 
@@ -49,17 +49,26 @@
 #include <sstream>
 #include <cassert>
 #include <thread>
+#include <cstdint>
+#include <atomic>
 
 // Boost headers go here
 
 // Geneva headers go here
 #include "hap/GRandomBase.hpp"
 #include "hap/GRandomDefines.hpp"
+#include "hap/GPhiloxEngine.hpp"
 #include "common/GLogger.hpp"
 
 namespace Gem {
 namespace Hap {
 
+/******************************************************************************/
+/** @brief The process-wide seed used by GRandomT<RANDOMCOUNTER> objects */
+G_API_HAP std::uint64_t counterRandomSeed();
+/** @brief Hands out a new stream id, unique for the calling thread and process */
+G_API_HAP std::uint64_t nextCounterRandomStream();
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -204,6 +213,24 @@ private:
 		return m_p->next();
 	}
 
+	/***************************************************************************/
+	/**
+	 * Copies random numbers in bulk out of the current container, retrieving
+	 * new containers as needed.
+	 */
+	void int_random_n(GRandomBase::result_type *out, std::size_t n) override {
+		while(n > 0) {
+			if (m_p->empty()) {
+				m_grf->returnUsedPackage(std::move(m_p));
+				getNewRandomContainer();
+			}
+
+			std::size_t nCopied = m_p->next_n(out, n);
+			out += nCopied;
+			n -= nCopied;
+		}
+	}
+
 	/***************************************************************************/
 	/**
 	 * (Re-)Initialization of p_. Checks that a valid GRandomFactory still
@@ -227,8 +254,8 @@ private:
 		std::uint32_t nRetries = 0;
 #endif /* DEBUG */
 
-		// Try until a valid container has been received. new01Container has
-		// a timeout of DEFAULTFACTORYGETWAIT internally.
+		// Try until a valid container has been received. The factory fills
+		// containers locally if none are available, so this should succeed at once.
 		while (not (m_p = m_grf->getNewRandomContainer())) {
 #ifdef DEBUG
 		   nRetries++;
@@ -326,11 +353,254 @@ private:
 		return m_rng();
 	}
 
+	/***************************************************************************/
+	/**
+	 * Produces random numbers in bulk, without a virtual call per item
+	 */
+	void int_random_n(GRandomBase::result_type *out, std::size_t n) override {
+		for(std::size_t i=0; i<n; i++) {
+			out[i] = m_rng();
+		}
+	}
+
 	/***************************************************************************/
 	/** @brief The actual generator for local random number creation */
 	G_BASE_GENERATOR m_rng;
 };
 
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * This specialization of the general GRandomT<> class produces random numbers
+ * in place, using the counter-based philox4x32 engine. No factory threads are
+ * involved and no data is exchanged between threads. Each object owns a stream
+ * identified by (seed, stream id). The default constructor uses the process-wide
+ * seed and a stream id derived from the id of the calling thread, so that
+ * objects created in different threads or one after another in the same thread
+ * never share a stream. Alternatively, seed and stream may be specified explicitly,
+ * e.g. to tie a stream to a given individual.
+ */
+template<>
+class GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>
+	: public Gem::Hap::GRandomBase
+{
+public:
+	/***************************************************************************/
+	/**
+	 * The standard constructor
+	 */
+	GRandomT() noexcept(false)
+		: Gem::Hap::GRandomBase()
+		, m_engine(counterRandomSeed(), nextCounterRandomStream())
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Initialization with an explicit seed and stream id
+	 */
+	GRandomT(std::uint64_t seed, std::uint64_t stream) noexcept
+		: Gem::Hap::GRandomBase()
+		, m_engine(seed, stream)
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Copy construction does nothing, delegates to default constructor, so
+	 * every object holds its own stream
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> const& cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Move construction does nothing, delegates to default constructor
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> && cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * The standard destructor
+	 */
+	~GRandomT() override = default;
+
+	/***************************************************************************/
+	/**
+	 * Copy-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> const& cp) noexcept(false)
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Move-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> && cp) noexcept(false)
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Positions this object at the start of the stream identified by (seed, stream)
+	 */
+	void reseed(std::uint64_t seed, std::uint64_t stream) noexcept {
+		m_engine.seed(seed, stream);
+	}
+
+private:
+	/***************************************************************************/
+	/**
+	 * This function produces uniform random numbers in place.
+	 */
+	GRandomBase::result_type int_random() override {
+		return m_engine();
+	}
+
+	/***************************************************************************/
+	/**
+	 * Produces random numbers in bulk, without a virtual call per item
+	 */
+	void int_random_n(GRandomBase::result_type *out, std::size_t n) override {
+		for(std::size_t i=0; i<n; i++) {
+			out[i] = m_engine();
+		}
+	}
+
+	/***************************************************************************/
+	/** @brief The counter-based engine */
+	philox4x32 m_engine;
+};
+
+/** @brief Convenience typedef */
+using GRandomCounter = GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>;
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * This specialization of the general GRandomT<> class behaves like
+ * GRandomT<RANDOMPROXY>, i.e. it takes its random numbers from the factory,
+ * until a stream is selected with reseed(). From then on, random numbers are
+ * produced in place by a counter-based engine keyed by (seed, stream), as in
+ * GRandomT<RANDOMCOUNTER>. This allows objects to keep the factory as their
+ * default source, while offering reproducible streams on request. Copies
+ * always start out in factory mode.
+ */
+template<>
+class GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>
+	: public Gem::Hap::GRandomBase
+{
+public:
+	/***************************************************************************/
+	/**
+	 * The standard constructor
+	 */
+	GRandomT() noexcept(false)
+		: Gem::Hap::GRandomBase()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Copy construction does nothing, delegates to default constructor
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> const& cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Move construction does nothing, delegates to default constructor
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> && cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * The standard destructor
+	 */
+	~GRandomT() override = default;
+
+	/***************************************************************************/
+	/**
+	 * Copy-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> const& cp) noexcept(false)
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Move-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> && cp) noexcept(false)
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Positions this object at the start of the stream identified by (seed, stream)
+	 * and switches it to the counter-based engine
+	 */
+	void reseed(std::uint64_t seed, std::uint64_t stream) noexcept {
+		m_counter.reseed(seed, stream);
+		m_useStream = true;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Switches this object back to the factory
+	 */
+	void resetStream() noexcept {
+		m_useStream = false;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Checks whether random numbers are currently produced by the counter-based engine
+	 */
+	bool usesStream() const noexcept {
+		return m_useStream;
+	}
+
+private:
+	/***************************************************************************/
+	/**
+	 * Emits a random number from the currently selected source
+	 */
+	GRandomBase::result_type int_random() override {
+		return m_useStream ? m_counter() : m_proxy();
+	}
+
+	/***************************************************************************/
+	/**
+	 * Produces random numbers in bulk from the currently selected source
+	 */
+	void int_random_n(GRandomBase::result_type *out, std::size_t n) override {
+		if(m_useStream) {
+			m_counter.fill_raw(out, n);
+		} else {
+			m_proxy.fill_raw(out, n);
+		}
+	}
+
+	/***************************************************************************/
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> m_proxy; ///< The default source of random numbers
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> m_counter; ///< The source of random numbers after reseed()
+	bool m_useStream = false; ///< Indicates whether m_counter was selected by reseed()
+};
+
+/** @brief Convenience typedef */
+using GRandomStream = GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM>;
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -0,0 +1,363 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <cstdint>
+#include <cmath>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+// Boost headers go here
+
+// Geneva headers go here
+
+namespace Gem {
+namespace Hap {
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * The tables of the Ziggurat method for normally distributed random numbers
+ * (G. Marsaglia, W. W. Tsang, "The Ziggurat Method for Generating Random
+ * Variables", Journal of Statistical Software 5(8), 2000), using 128 layers.
+ * The tables are calculated once per process upon first use, see
+ * ziggurat_normal_tables().
+ */
+struct ziggurat_tables {
+	 static constexpr std::size_t N_LAYERS = 128; ///< The number of layers of the ziggurat
+	 static constexpr double R = 3.442619855899; ///< The start of the tail
+	 static constexpr double V = 9.91256303526217e-3; ///< The area of each layer
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates the tables
+	  */
+	 ziggurat_tables() {
+		 const double m1 = 2147483648.; // 2^31
+		 double dn = R;
+		 double tn = dn;
+		 const double q = V / std::exp(-0.5 * dn * dn);
+
+		 kn[0] = static_cast<std::uint32_t>((dn / q) * m1);
+		 kn[1] = 0;
+
+		 wn[0] = q / m1;
+		 wn[N_LAYERS - 1] = dn / m1;
+
+		 fn[0] = 1.;
+		 fn[N_LAYERS - 1] = std::exp(-0.5 * dn * dn);
+
+		 for (std::size_t i = N_LAYERS - 2; i >= 1; i--) {
+			 dn = std::sqrt(-2. * std::log(V / dn + std::exp(-0.5 * dn * dn)));
+			 kn[i + 1] = static_cast<std::uint32_t>((dn / tn) * m1);
+			 tn = dn;
+			 fn[i] = std::exp(-0.5 * dn * dn);
+			 wn[i] = dn / m1;
+		 }
+	 }
+
+	 std::array<std::uint32_t, N_LAYERS> kn{}; ///< Acceptance thresholds for the fast path
+	 std::array<double, N_LAYERS> wn{}; ///< Scaling factors from integers to layer widths
+	 std::array<double, N_LAYERS> fn{}; ///< Values of the density at the layer boundaries
+};
+
+/******************************************************************************/
+/**
+ * Gives access to the process-wide ziggurat tables
+ */
+inline const ziggurat_tables& ziggurat_normal_tables() {
+	static const ziggurat_tables tables;
+	return tables;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves 32 random bits from a uniform random bit generator with at least
+ * 32 bits of output
+ */
+template <typename T_Generator>
+inline std::uint32_t ziggurat_raw32(T_Generator& g) {
+	static_assert(
+		(T_Generator::max)() - (T_Generator::min)() >= 0xFFFFFFFFu
+		, "ziggurat_raw32: The generator needs to produce at least 32 random bits"
+	);
+	return static_cast<std::uint32_t>(g() - (T_Generator::min)());
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the fast path of the ziggurat accepts a candidate built from
+ * the raw numbers idx_raw (selecting the layer) and val_raw (position and
+ * sign inside of the layer). Both should be independent random numbers.
+ */
+inline bool ziggurat_accepts(
+	std::uint32_t idx_raw
+	, std::uint32_t val_raw
+	, const ziggurat_tables& t
+) {
+	const std::int32_t hz = static_cast<std::int32_t>(val_raw);
+	const std::uint32_t ahz = hz < 0 ? 0u - val_raw : val_raw;
+	return ahz < t.kn[idx_raw & (ziggurat_tables::N_LAYERS - 1)];
+}
+
+/******************************************************************************/
+/**
+ * Calculates the candidate of the fast path. The result is only valid if
+ * ziggurat_accepts() returns true for the same raw numbers.
+ */
+inline double ziggurat_candidate(
+	std::uint32_t idx_raw
+	, std::uint32_t val_raw
+	, const ziggurat_tables& t
+) {
+	return static_cast<double>(static_cast<std::int32_t>(val_raw)) * t.wn[idx_raw & (ziggurat_tables::N_LAYERS - 1)];
+}
+
+/******************************************************************************/
+/**
+ * The slow path of the ziggurat: Handles candidates rejected by the fast path
+ * (wedges and tail), drawing further random numbers from g as needed. This
+ * happens for roughly 1% of all values.
+ */
+template <typename T_Generator>
+double ziggurat_fix(
+	std::uint32_t idx_raw
+	, std::uint32_t val_raw
+	, T_Generator& g
+	, const ziggurat_tables& t
+) {
+	// Uniform numbers in ]0,1[
+	auto uni = [&g]() -> double { return (static_cast<double>(ziggurat_raw32(g)) + 0.5) * (1. / 4294967296.); };
+
+	for(;;) {
+		if(ziggurat_accepts(idx_raw, val_raw, t)) {
+			return ziggurat_candidate(idx_raw, val_raw, t);
+		}
+
+		const std::size_t iz = idx_raw & (ziggurat_tables::N_LAYERS - 1);
+		const std::int32_t hz = static_cast<std::int32_t>(val_raw);
+		const double x = ziggurat_candidate(idx_raw, val_raw, t);
+
+		if(0 == iz) { // The base layer -- sample from the tail (Marsaglia 1964)
+			double xt, y;
+			do {
+				xt = -std::log(uni()) / ziggurat_tables::R;
+				y = -std::log(uni());
+			} while(y + y < xt * xt);
+			return hz > 0 ? ziggurat_tables::R + xt : -ziggurat_tables::R - xt;
+		}
+
+		// The wedge of layer iz
+		if(t.fn[iz] + uni() * (t.fn[iz - 1] - t.fn[iz]) < std::exp(-0.5 * x * x)) {
+			return x;
+		}
+
+		// Start over with new raw numbers
+		idx_raw = ziggurat_raw32(g);
+		val_raw = ziggurat_raw32(g);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Calculates a standard normal value from two independent raw numbers,
+ * falling back to the slow path (and further numbers from g) when needed
+ */
+template <typename T_Generator>
+inline double ziggurat_from_raw(
+	std::uint32_t idx_raw
+	, std::uint32_t val_raw
+	, T_Generator& g
+	, const ziggurat_tables& t
+) {
+	if(ziggurat_accepts(idx_raw, val_raw, t)) {
+		return ziggurat_candidate(idx_raw, val_raw, t);
+	}
+	return ziggurat_fix(idx_raw, val_raw, g, t);
+}
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * A normal distribution based on the Ziggurat method. It models the API of
+ * std::normal_distribution and may be used as a drop-in replacement. Other
+ * than the polar method used by libstdc++, ~99% of all values are produced
+ * from two raw random numbers with a single table lookup and comparison.
+ * The layer index and the value inside of the layer are taken from two
+ * independent raw numbers, avoiding the correlation of the original algorithm.
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+class ziggurat_normal_distribution
+{
+public:
+	 using result_type = fp_type;
+
+	 /**************************************************************************/
+	 /**
+	  * The parameters of the distribution
+	  */
+	 class param_type {
+	 public:
+		  using distribution_type = ziggurat_normal_distribution<fp_type>;
+
+		  explicit param_type(fp_type mean = fp_type(0), fp_type stddev = fp_type(1))
+			  : m_mean(mean)
+			  , m_stddev(stddev)
+		  { /* nothing */ }
+
+		  fp_type mean() const { return m_mean; }
+		  fp_type stddev() const { return m_stddev; }
+
+		  bool operator==(const param_type& other) const {
+			  return m_mean == other.m_mean && m_stddev == other.m_stddev;
+		  }
+
+		  bool operator!=(const param_type& other) const {
+			  return not this->operator==(other);
+		  }
+
+	 private:
+		  fp_type m_mean = fp_type(0);
+		  fp_type m_stddev = fp_type(1);
+	 };
+
+	 /**************************************************************************/
+	 /**
+	  * Initialization with mean and standard deviation
+	  */
+	 explicit ziggurat_normal_distribution(fp_type mean = fp_type(0), fp_type stddev = fp_type(1))
+		 : m_params(mean, stddev)
+	 { /* nothing */ }
+
+	 /**
+	  * Initialization with a param_type object
+	  */
+	 explicit ziggurat_normal_distribution(const param_type& params)
+		 : m_params(params)
+	 { /* nothing */ }
+
+	 /** @brief The distribution holds no state between calls */
+	 void reset() { /* nothing */ }
+
+	 /** @brief Returns the mean of the distribution */
+	 fp_type mean() const { return m_params.mean(); }
+	 /** @brief Returns the standard deviation of the distribution */
+	 fp_type stddev() const { return m_params.stddev(); }
+
+	 /** @brief Returns the parameters of the distribution */
+	 param_type param() const { return m_params; }
+	 /** @brief Sets the parameters of the distribution */
+	 void param(const param_type& params) { m_params = params; }
+
+	 /** @brief The smallest possible value */
+	 fp_type (min)() const { return std::numeric_limits<fp_type>::lowest(); }
+	 /** @brief The largest possible value */
+	 fp_type (max)() const { return (std::numeric_limits<fp_type>::max)(); }
+
+	 /**************************************************************************/
+	 /**
+	  * Returns a normally distributed value, using the parameters stored internally
+	  */
+	 template <class T_Generator>
+	 result_type operator()(T_Generator& g) {
+		 return (*this)(g, m_params);
+	 }
+
+	 /**
+	  * Returns a normally distributed value, using the supplied parameters
+	  */
+	 template <class T_Generator>
+	 result_type operator()(T_Generator& g, const param_type& params) {
+		 const std::uint32_t idx_raw = ziggurat_raw32(g);
+		 const std::uint32_t val_raw = ziggurat_raw32(g);
+		 return static_cast<fp_type>(
+			 params.mean() + params.stddev() * ziggurat_from_raw(idx_raw, val_raw, g, ziggurat_normal_tables())
+		 );
+	 }
+
+	 /**************************************************************************/
+	 /**
+	  * Fills a range with normally distributed values, using the supplied parameters
+	  */
+	 template <class T_Generator>
+	 void fill(T_Generator& g, fp_type *out, std::size_t n, const param_type& params) {
+		 const ziggurat_tables& t = ziggurat_normal_tables();
+		 for(std::size_t i=0; i<n; i++) {
+			 const std::uint32_t idx_raw = ziggurat_raw32(g);
+			 const std::uint32_t val_raw = ziggurat_raw32(g);
+			 out[i] = static_cast<fp_type>(params.mean() + params.stddev() * ziggurat_from_raw(idx_raw, val_raw, g, t));
+		 }
+	 }
+
+	 /**
+	  * Fills a range with normally distributed values, using the parameters stored internally
+	  */
+	 template <class T_Generator>
+	 void fill(T_Generator& g, fp_type *out, std::size_t n) {
+		 this->fill(g, out, n, m_params);
+	 }
+
+	 /** @brief Checks for equality with another distribution */
+	 bool operator==(const ziggurat_normal_distribution<fp_type>& other) const {
+		 return m_params == other.m_params;
+	 }
+
+	 /** @brief Checks for inequality with another distribution */
+	 bool operator!=(const ziggurat_normal_distribution<fp_type>& other) const {
+		 return m_params != other.m_params;
+	 }
+
+private:
+	 param_type m_params; ///< The parameters of the distribution
+};
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+
+} /* namespace Hap */
+} /* namespace Gem */
@@ -50,7 +50,10 @@
 #include <sstream>
 #include <string>
 #include <vector>
+#include <bitset>
 #include <algorithm>
+#include <numeric>
+#include <cmath>
 
 // Boost header files go here
 #include <boost/test/unit_test.hpp>
@@ -61,6 +64,7 @@
 #include "common/GCommonEnums.hpp"
 #include "hap/GRandomT.hpp"
 #include "hap/GRandomDistributionsT.hpp"
+#include "hap/GZigguratNormalT.hpp"
 
 using namespace Gem::Hap;
 
@@ -203,6 +207,250 @@ public:
 		}
 
 		//------------------------------------------------------------------------------
+
+		{ // Check the philox4x32 engine against the known-answer vectors of the Random123 reference implementation
+			auto r0 = philox4x32::bijection({{0, 0, 0, 0}}, {{0, 0}});
+			BOOST_CHECK(r0[0] == 0x6627e8d5u && r0[1] == 0xe169c58du && r0[2] == 0xbc57ac4cu && r0[3] == 0x9b00dbd8u);
+
+			auto r1 = philox4x32::bijection({{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}}, {{0xffffffffu, 0xffffffffu}});
+			BOOST_CHECK(r1[0] == 0x408f276du && r1[1] == 0x41c83b0eu && r1[2] == 0xa20bc7c6u && r1[3] == 0x6d5451fdu);
+
+			auto r2 = philox4x32::bijection({{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}}, {{0xa4093822u, 0x299f31d0u}});
+			BOOST_CHECK(r2[0] == 0xd16cfe09u && r2[1] == 0x94fdccebu && r2[2] == 0x5001e420u && r2[3] == 0x24126ea1u);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that discard() of the philox4x32 engine is equivalent to drawing numbers
+			for(std::uint64_t n: {0, 1, 3, 4, 5, 13, 1000}) {
+				philox4x32 drawn(42, 7), skipped(42, 7);
+				for(std::uint64_t i=0; i<n; i++) drawn();
+				skipped.discard(n);
+				BOOST_CHECK(drawn == skipped);
+				BOOST_CHECK(drawn() == skipped());
+			}
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that RANDOMCOUNTER objects with the same (seed, stream) produce identical and otherwise different sequences
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_1(1234, 5), gr_2(1234, 5), gr_3(1234, 6);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_def_1, gr_def_2;
+
+			std::size_t nEqual_12 = 0, nEqual_13 = 0, nEqual_def = 0;
+			for(std::size_t i=0; i<1000; i++) {
+				auto r1 = gr_1(), r2 = gr_2(), r3 = gr_3();
+				if(r1 == r2) nEqual_12++;
+				if(r1 == r3) nEqual_13++;
+				if(gr_def_1() == gr_def_2()) nEqual_def++;
+			}
+
+			BOOST_CHECK(nEqual_12 == 1000);
+			BOOST_CHECK(nEqual_13 < 10);
+			BOOST_CHECK(nEqual_def < 10);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that RANDOMSTREAM objects only follow a counter-based stream after reseed()
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> gr_stream;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_counter(1234, 5);
+
+			BOOST_CHECK(not gr_stream.usesStream());
+			gr_stream.reseed(1234, 5);
+			BOOST_CHECK(gr_stream.usesStream());
+
+			std::vector<GRandomBase::result_type> bulk(100), single(100);
+			gr_stream.fill_raw(bulk.data(), bulk.size());
+			for(auto& r: single) r = gr_counter();
+			BOOST_CHECK(bulk == single);
+
+			// Copies start out in factory mode
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMSTREAM> gr_copy(gr_stream);
+			BOOST_CHECK(not gr_copy.usesStream());
+
+			gr_stream.resetStream();
+			BOOST_CHECK(not gr_stream.usesStream());
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Test that uniform_int(min,max) covers the entire range, including the upper boundary in RANDOMCOUNTER mode
+			// A few settings
+			const std::int32_t MINRANDOM=-10;
+			const std::int32_t MAXRANDOM= 10;
+
+			std::shared_ptr<GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>> gr_ptr(new Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>());
+			std::uniform_int_distribution<std::int32_t> uniform_int_distribution(MINRANDOM, MAXRANDOM);
+
+			std::vector<std::int32_t> randomHist(21, 0); // 21 positions from -10 to 10
+
+			for(std::size_t i=0; i<nTests_; i++) {
+				std::int32_t randVal = uniform_int_distribution(*gr_ptr);
+				BOOST_CHECK(randVal >= MINRANDOM && randVal <= MAXRANDOM);
+				BOOST_CHECK_NO_THROW(randomHist.at(std::size_t(randVal+10)) += 1);
+			}
+
+			// Due to the large number of entries, we should have > 0 entries in all positions
+			for(std::size_t i=0; i<21; i++) {
+				BOOST_CHECK(randomHist.at(i) > 0);
+			}
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the bulk functions of GRandomBase for all flavours
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr_proxy;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMLOCAL> gr_local;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_counter;
+
+			for(GRandomBase *gr_ptr: std::vector<GRandomBase *>{&gr_proxy, &gr_local, &gr_counter}) {
+				const std::size_t N = 100001; // odd and larger than the size of a random_container
+
+				// Uniform double values must lie in [0,1[ and have a mean of about 0.5
+				std::vector<double> u(N);
+				BOOST_CHECK_NO_THROW(gr_ptr->fill_uniform01(u));
+				BOOST_CHECK(std::all_of(u.begin(), u.end(), [](double x) { return x >= 0. && x < 1.; }));
+				double mean_u = std::accumulate(u.begin(), u.end(), 0.) / double(N);
+				BOOST_CHECK(std::fabs(mean_u - 0.5) < 0.01);
+
+				// Uniform float values must lie in [0,1[
+				std::vector<float> uf(N);
+				BOOST_CHECK_NO_THROW(gr_ptr->fill_uniform01(uf));
+				BOOST_CHECK(std::all_of(uf.begin(), uf.end(), [](float x) { return x >= 0.f && x < 1.f; }));
+
+				// Normal values must have roughly the requested mean and sigma
+				std::vector<double> g(N);
+				BOOST_CHECK_NO_THROW(gr_ptr->fill_normal(g, 2., 0.5));
+				double mean_g = std::accumulate(g.begin(), g.end(), 0.) / double(N);
+				double var_g = 0.;
+				for(auto x: g) var_g += (x - mean_g)*(x - mean_g);
+				var_g /= double(N - 1);
+				BOOST_CHECK(std::fabs(mean_g - 2.) < 0.01);
+				BOOST_CHECK(std::fabs(std::sqrt(var_g) - 0.5) < 0.01);
+
+				// Bernoulli values must respect the probability, including the edge cases
+				std::vector<std::uint8_t> b(N);
+				BOOST_CHECK_NO_THROW(gr_ptr->fill_bernoulli(b, 0.25));
+				double fraction = double(std::count(b.begin(), b.end(), std::uint8_t(1))) / double(N);
+				BOOST_CHECK(std::fabs(fraction - 0.25) < 0.01);
+				gr_ptr->fill_bernoulli(b, 0.);
+				BOOST_CHECK(std::count(b.begin(), b.end(), std::uint8_t(0)) == std::ptrdiff_t(N));
+				gr_ptr->fill_bernoulli(b, 1.);
+				BOOST_CHECK(std::count(b.begin(), b.end(), std::uint8_t(1)) == std::ptrdiff_t(N));
+
+				// The same for bits that are drawn a whole word at a time
+				std::vector<std::uint64_t> w(N / 64);
+				for(double p: {0.1, 0.5, 0.75}) {
+					BOOST_CHECK_NO_THROW(gr_ptr->fill_bernoulli_words(w, p));
+					std::size_t nSet = 0;
+					for(auto word: w) nSet += std::bitset<64>(word).count();
+					BOOST_CHECK(std::fabs(double(nSet) / double(64 * w.size()) - p) < 0.01);
+				}
+				gr_ptr->fill_bernoulli_words(w, 0.);
+				BOOST_CHECK(std::count(w.begin(), w.end(), std::uint64_t(0)) == std::ptrdiff_t(w.size()));
+				gr_ptr->fill_bernoulli_words(w, 1.);
+				BOOST_CHECK(std::count(w.begin(), w.end(), ~std::uint64_t(0)) == std::ptrdiff_t(w.size()));
+			}
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that bulk retrieval of raw numbers yields the same sequence as single retrieval
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_single(99, 1), gr_bulk(99, 1);
+			std::vector<GRandomBase::result_type> raw(1001);
+			gr_bulk.fill_raw(raw.data(), raw.size());
+
+			bool identical = true;
+			for(auto r: raw) {
+				if(r != gr_single()) identical = false;
+			}
+			BOOST_CHECK(identical);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the moments and tails of the ziggurat_normal_distribution
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr(2020, 3);
+			ziggurat_normal_distribution<double> zn;
+
+			const std::size_t N = 1000000;
+			double sum = 0., sum2 = 0.;
+			std::size_t nOneSigma = 0, nTail = 0, nNegTail = 0;
+			for(std::size_t i=0; i<N; i++) {
+				double x = zn(gr, ziggurat_normal_distribution<double>::param_type(0., 1.));
+				sum += x;
+				sum2 += x*x;
+				if(std::fabs(x) < 1.) nOneSigma++;
+				if(x > ziggurat_tables::R) nTail++;
+				if(x < -ziggurat_tables::R) nNegTail++;
+			}
+
+			double mean = sum / double(N);
+			double sigma = std::sqrt(sum2 / double(N) - mean*mean);
+			BOOST_CHECK(std::fabs(mean) < 0.005);
+			BOOST_CHECK(std::fabs(sigma - 1.) < 0.005);
+			BOOST_CHECK(std::fabs(double(nOneSigma) / double(N) - 0.682689) < 0.003);
+			// P(x > 3.4426) is about 2.9e-4, i.e. about 290 values in each tail
+			BOOST_CHECK(nTail > 200 && nTail < 400);
+			BOOST_CHECK(nNegTail > 200 && nNegTail < 400);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that package storage is aligned and that huge pages are only used for large packages
+			bool hugePages = true;
+			G_BASE_GENERATOR::result_type *p = acquire_random_storage(100, hugePages);
+			BOOST_CHECK(0 == reinterpret_cast<std::uintptr_t>(p) % RANDOMSTORAGEALIGNMENT);
+			BOOST_CHECK(not hugePages); // Too small for a huge page
+			release_random_storage(p);
+
+			hugePages = true;
+			std::size_t nLarge = RANDOMHUGEPAGESIZE/sizeof(G_BASE_GENERATOR::result_type);
+			p = acquire_random_storage(nLarge, hugePages);
+			BOOST_CHECK(0 == reinterpret_cast<std::uintptr_t>(p) % RANDOMSTORAGEALIGNMENT);
+			if(hugePages) BOOST_CHECK(0 == reinterpret_cast<std::uintptr_t>(p) % RANDOMHUGEPAGESIZE);
+			release_random_storage(p);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that the package size of the factory may be changed at run-time
+			std::size_t oldArraySize = GRANDOMFACTORY->getCurrentArraySize();
+
+			BOOST_CHECK_NO_THROW(GRANDOMFACTORY->setArraySize(37));
+			BOOST_CHECK(37 == GRANDOMFACTORY->getCurrentArraySize());
+
+			// Proxies keep working while packages of different sizes are in circulation
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr;
+			std::uniform_real_distribution<double> uniform_real;
+			for(std::size_t i=0; i<100*oldArraySize; i++) {
+				double x = uniform_real(gr);
+				BOOST_CHECK(x >= 0. && x < 1.);
+			}
+
+			BOOST_CHECK_NO_THROW(GRANDOMFACTORY->setArraySize(oldArraySize));
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that packages cached before a change of the package size are not handed out
+			std::size_t oldArraySize = GRANDOMFACTORY->getCurrentArraySize();
+
+			// Make sure the local cache holds packages of the old size
+			GRANDOMFACTORY->returnUsedPackage(GRANDOMFACTORY->getNewRandomContainer());
+
+			BOOST_CHECK_NO_THROW(GRANDOMFACTORY->setArraySize(41));
+			for(std::size_t i=0; i<4*DEFAULTFACTORYCACHESIZE; i++) {
+				std::unique_ptr<random_container> p = GRANDOMFACTORY->getNewRandomContainer();
+				BOOST_CHECK(41 == p->size());
+				GRANDOMFACTORY->returnUsedPackage(std::move(p));
+			}
+
+			BOOST_CHECK_NO_THROW(GRANDOMFACTORY->setArraySize(oldArraySize));
+		}
+
+		//------------------------------------------------------------------------------
 	}
 
 	/***********************************************************************************/
@@ -210,7 +458,10 @@ public:
 	 * Test features that are expected to fail
 	 */
 	void failures_expected() {
-		{ /* nothing */ }
+		{ // Packages and buffers may not be empty
+			BOOST_CHECK_THROW(GRANDOMFACTORY->setArraySize(0), gemfony_exception);
+			BOOST_CHECK_THROW(GRANDOMFACTORY->setBufferSize(0), gemfony_exception);
+		}
 	}
 
 	/***********************************************************************************/
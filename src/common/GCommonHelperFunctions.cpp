@@ -479,6 +479,64 @@ condnotset(std::string const &F, std::string const &D) {
    throw(gemfony_exception(error.str()));
 }
 
+/******************************************************************************/
+/**
+ * Packs a std::vector<bool> into 64-bit words. Bit i of the vector ends up in
+ * bit (i % 64) of word (i / 64). Unused bits of the last word are set to 0, so
+ * that word-wise comparisons and popcounts of packed vectors are meaningful.
+ *
+ * @param bits The bit vector to be packed
+ * @param words Will hold the packed words
+ */
+void
+packBits(std::vector<bool> const &bits, std::vector<std::uint64_t> &words) {
+	const std::size_t nBits = bits.size();
+	words.assign((nBits + GBITSPERWORD - 1) / GBITSPERWORD, std::uint64_t(0));
+
+	std::size_t pos = 0;
+	for(auto& w: words) {
+		const std::size_t nInWord = (std::min)(GBITSPERWORD, nBits - pos);
+		std::uint64_t word = 0;
+		for(std::size_t b = 0; b < nInWord; b++) {
+			word |= std::uint64_t(bits[pos + b]) << b;
+		}
+		w = word;
+		pos += nInWord;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Unpacks a given number of bits from 64-bit words into a std::vector<bool>.
+ * This is the inverse of packBits().
+ *
+ * @param words The packed words
+ * @param nBits The number of bits to extract
+ * @param bits Will hold the unpacked bits
+ */
+void
+unpackBits(std::vector<std::uint64_t> const &words, std::size_t nBits, std::vector<bool> &bits) {
+	if(words.size() * GBITSPERWORD < nBits) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In unpackBits(): Error!" << std::endl
+				<< "Requested " << nBits << " bits from only " << words.size() << " words" << std::endl
+		);
+	}
+
+	bits.resize(nBits);
+
+	std::size_t pos = 0;
+	for(auto w: words) {
+		if(pos >= nBits) break;
+		const std::size_t nInWord = (std::min)(GBITSPERWORD, nBits - pos);
+		for(std::size_t b = 0; b < nInWord; b++) {
+			bits[pos + b] = (w >> b) & std::uint64_t(1);
+		}
+		pos += nInWord;
+	}
+}
+
 /******************************************************************************/
 
 } /* namespace Common */
@@ -75,6 +75,11 @@ division_by_0::division_by_0() noexcept
 // Swaps two nil structs
 void nil::swap(nil &n) { }
 
+// Swaps two variable_ structs
+void variable_::swap(variable_ &v) {
+	std::swap(slot_, v.slot_);
+}
+
 // Swaps two signed_ structs
 void signed_::swap(signed_ &s) {
 	std::swap(sign, s.sign);
@@ -121,6 +126,10 @@ void swap(Gem::Common::nil &a, Gem::Common::nil &b) {
 	a.swap(b);
 }
 
+void swap(Gem::Common::variable_ &a, Gem::Common::variable_ &b) {
+	a.swap(b);
+}
+
 void swap(Gem::Common::signed_ &a, Gem::Common::signed_ &b) {
 	a.swap(b);
 }
@@ -35,6 +35,7 @@
  ********************************************************************************/
 
 #include "geneva/GAdaptorT.hpp"
+#include "common/GCommonHelperFunctions.hpp"
 
 
 namespace Gem {
@@ -63,7 +64,7 @@ std::size_t GAdaptorT<bool,double>::adapt(
 	// Update the adaption probability, if requested by the user
 	if(m_adaptAdProb > double(0.)) {
 		m_adProb *= gexp(
-			m_normal_distribution(gr, typename std::normal_distribution<double>::param_type(0.,m_adaptAdProb))
+			m_normal_distribution(gr, typename Gem::Hap::ziggurat_normal_distribution<double>::param_type(0.,m_adaptAdProb))
 		);
 		Gem::Common::enforceRangeConstraint<double>(
 			m_adProb
@@ -75,24 +76,85 @@ std::size_t GAdaptorT<bool,double>::adapt(
 
 	bool dummy_val;
 
+	// Adaptors that merely flip bits may draw the bits to be flipped 64 at a time.
+	// Masks are drawn in blocks on the stack. std::vector<bool> gives no access to
+	// its words, so only the set bits of each mask are flipped, one at a time
+	auto flip_words = [&](double p) -> std::size_t {
+		std::array<std::uint64_t, 64> masks{};
+		const std::size_t nBits = valVec.size();
+		std::size_t nFlipped = 0;
+
+		for(std::size_t blockStart = 0; blockStart < nBits; blockStart += masks.size() * GBITSPERWORD) {
+			const std::size_t nBlockBits = (std::min)(masks.size() * GBITSPERWORD, nBits - blockStart);
+			const std::size_t nBlockWords = (nBlockBits + GBITSPERWORD - 1) / GBITSPERWORD;
+			gr.fill_bernoulli_words(masks.data(), nBlockWords, p);
+
+			for(std::size_t w = 0; w < nBlockWords; w++) {
+				const std::size_t wordStart = blockStart + w * GBITSPERWORD;
+				const std::size_t nInWord = (std::min)(GBITSPERWORD, nBits - wordStart);
+				std::uint64_t mask = masks[w];
+
+				// Bits beyond the end of valVec must not be counted
+				if(nInWord < GBITSPERWORD) {
+					mask &= (std::uint64_t(1) << nInWord) - 1;
+				}
+				if(not mask) continue;
+
+				nFlipped += std::bitset<GBITSPERWORD>(mask).count();
+				for(; mask; mask &= mask - 1) { // Clears the lowest set bit
+					const std::size_t b = std::bitset<GBITSPERWORD>((mask & (~mask + 1)) - 1).count();
+					valVec[wordStart + b].flip();
+				}
+			}
+		}
+
+		for(std::size_t i=0; i<nFlipped; i++) {
+			adaptAdaption(range, gr);
+		}
+		return nFlipped;
+	};
+
 	if(adaptionMode::WITHPROBABILITY == m_adaptionMode) { // The most likely case is indeterminate (means: "depends")
-		for (auto && val: valVec) {
-			// A likelihood of m_adProb for adaption
-			if(m_weighted_bool(gr, std::bernoulli_distribution::param_type(gfabs(m_adProb)))) {
-				dummy_val = val;
+		double adProb = gfabs(m_adProb);
+
+		if(adProb > 0. && adProb < SKIPSAMPLINGMAXADPROB) {
+			// Jump from one adapted position to the next (see the general adapt() function)
+			std::geometric_distribution<std::size_t>::param_type gap(adProb);
+			std::size_t pos = 0, skip = 0;
+			while((skip = m_geometric_gap(gr, gap)) < valVec.size() - pos) {
+				pos += skip;
+				dummy_val = valVec[pos];
 				adaptAdaption(range, gr);
 				customAdaptions(dummy_val, range, gr); // does not know about the bool-proxy of std::vector<bool>
-				val=dummy_val;
+				valVec[pos] = dummy_val;
 				nAdapted += 1;
+				pos += 1;
+			}
+		} else if(adaptsBitsWordWise()) {
+			nAdapted = flip_words(adProb);
+		} else {
+			for (auto && val: valVec) {
+				// A likelihood of m_adProb for adaption
+				if(m_weighted_bool(gr, std::bernoulli_distribution::param_type(adProb))) {
+					dummy_val = val;
+					adaptAdaption(range, gr);
+					customAdaptions(dummy_val, range, gr); // does not know about the bool-proxy of std::vector<bool>
+					val=dummy_val;
+					nAdapted += 1;
+				}
 			}
 		}
 	} else if(adaptionMode::ALWAYS == m_adaptionMode) { // always adapt
-		for (auto && val: valVec) {
-			dummy_val = val;
-			adaptAdaption(range, gr);
-			customAdaptions(dummy_val, range, gr);
-			val=dummy_val;
-			nAdapted += 1;
+		if(adaptsBitsWordWise()) {
+			nAdapted = flip_words(1.);
+		} else {
+			for (auto && val: valVec) {
+				dummy_val = val;
+				adaptAdaption(range, gr);
+				customAdaptions(dummy_val, range, gr);
+				val=dummy_val;
+				nAdapted += 1;
+			}
 		}
 	}
 
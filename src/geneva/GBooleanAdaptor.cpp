@@ -84,6 +84,31 @@ void GBooleanAdaptor::customAdaptions(
 	value == true ? value = false : value = true;
 }
 
+/******************************************************************************/
+/**
+ * Determines whether collections of bits are handed to this adaptor as a whole.
+ * The bits to be flipped are then drawn a word at a time, and the adaption
+ * probability is self-adapted once per collection instead of once per bit.
+ * This is off by default.
+ *
+ * @param adaptBitsWordWise Whether collections of bits should be adapted as a whole
+ */
+void GBooleanAdaptor::setAdaptBitsWordWise(bool adaptBitsWordWise) {
+	m_adaptBitsWordWise = adaptBitsWordWise;
+}
+
+/******************************************************************************/
+/**
+ * Indicates whether collections of bits are adapted as a whole, a word at a
+ * time. customAdaptions() simply flips bits, so this is possible if the user
+ * has asked for it.
+ *
+ * @return A boolean indicating whether collections of bits are adapted as a whole
+ */
+bool GBooleanAdaptor::adaptsBitsWordWise() const {
+	return m_adaptBitsWordWise;
+}
+
 /******************************************************************************/
 /**
  * Searches for compliance with expectations with respect to another object
@@ -108,7 +133,8 @@ void GBooleanAdaptor::compare_(
 	// Compare our parent data ...
 	Gem::Common::compare_base_t<GAdaptorT<bool>>(*this, *p_load, token);
 
-	// ... no local data
+	// ... and then the local data
+	compare_t(IDENTITY(m_adaptBitsWordWise, p_load->m_adaptBitsWordWise), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -144,7 +170,8 @@ void GBooleanAdaptor::load_(const GObject *cp) {
 	// Load our parent class'es data ...
 	GAdaptorT<bool>::load_(cp);
 
-	// ... no local data
+	// ... and then our local data
+	m_adaptBitsWordWise = p_load->m_adaptBitsWordWise;
 }
 
 /******************************************************************************/
@@ -178,6 +205,10 @@ bool GBooleanAdaptor::modify_GUnitTests_() {
 	// Call the parent class'es function
 	if (GAdaptorT<bool>::modify_GUnitTests_()) result = true;
 
+	// A harmless change
+	m_adaptBitsWordWise = not m_adaptBitsWordWise;
+	result = true;
+
 	return result;
 #else /* GEM_TESTING */  // If this function is called when GEM_TESTING isn't set, throw
    Gem::Common::condnotset("GBooleanAdaptor::modify_GUnitTests", "GEM_TESTING");
@@ -238,6 +269,23 @@ void GBooleanAdaptor::specificTestsNoFailureExpected_GUnitTests_() {
 
 	// --------------------------------------------------------------------------
 
+	{ // Check that word-wise adaption is off by default and may be switched on
+		GBooleanAdaptor gba1;
+		BOOST_CHECK(not gba1.adaptsBitsWordWise());
+		BOOST_CHECK_NO_THROW(gba1.setAdaptBitsWordWise(true));
+		BOOST_CHECK(gba1.adaptsBitsWordWise());
+
+		// The setting is copied and loaded
+		GBooleanAdaptor gba2(gba1);
+		BOOST_CHECK(gba2.adaptsBitsWordWise());
+		GBooleanAdaptor gba3;
+		BOOST_CHECK(gba3 != gba1);
+		BOOST_CHECK_NO_THROW(gba3.load(gba1));
+		BOOST_CHECK(gba3 == gba1);
+	}
+
+	// --------------------------------------------------------------------------
+
 	{ // Check that the adaptor returns the correct adaptor id
 		std::shared_ptr <GBooleanAdaptor> p_test = this->clone<GBooleanAdaptor>();
 
@@ -51,10 +51,8 @@ GBooleanCollection::GBooleanCollection(const std::size_t &nval)
 	: GParameterCollectionT<bool>()
 {
 	Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMLOCAL> gr;
-	std::bernoulli_distribution bernoulli_distribution; // defaults to 0.5
-	for (std::size_t i = 0; i < nval; i++) {
-		this->push_back(bernoulli_distribution(gr));
-	}
+	this->m_data_cnt.resize(nval);
+	this->fillRandomBits(0.5, gr);
 }
 
 // Tested in this class
@@ -151,17 +149,8 @@ bool GBooleanCollection::randomInit_(
 	const activityMode &am
 	, Gem::Hap::GRandomBase& gr
 ) {
-	bool randomized = false;
-
-	std::bernoulli_distribution bernoulli_distribution; // defaults to 0.5
-
-	// Compare http://stackoverflow.com/questions/15927033/what-is-the-correct-way-of-using-c11s-range-based-for
-	for(auto&& b: this->m_data_cnt) {
-		b = bernoulli_distribution(gr);
-		randomized = true;
-	}
-
-	return randomized;
+	this->fillRandomBits(0.5, gr);
+	return not this->m_data_cnt.empty();
 }
 
 /******************************************************************************/
@@ -176,8 +165,6 @@ bool GBooleanCollection::randomInit_(
 	, const activityMode &
 	, Gem::Hap::GRandomBase& gr
 ) {
-	bool randomized = false;
-
 	// Do some error checks
 	if(not Gem::Common::checkRangeCompliance(probability, 0., 1., "GBooleanCollection::randomInit_(probability)")) {
 		throw gemfony_exception(
@@ -187,16 +174,34 @@ bool GBooleanCollection::randomInit_(
 		);
 	}
 
-	// Obtain access to a random number generator
-	std::bernoulli_distribution bernoulli_distribution(probability);
+	this->fillRandomBits(probability, gr);
+	return not this->m_data_cnt.empty();
+}
 
-	// Compare http://stackoverflow.com/questions/15927033/what-is-the-correct-way-of-using-c11s-range-based-for
-	for(auto&& b: this->m_data_cnt) {
-		b = bernoulli_distribution(gr);
-		randomized = true;
-	}
+/******************************************************************************/
+/**
+ * Assigns random values to all bits of the collection. The random bits are
+ * drawn 64 at a time, in blocks held on the stack, and written in place.
+ *
+ * @param probability The probability for true values in the collection
+ */
+void GBooleanCollection::fillRandomBits(
+	const double &probability
+	, Gem::Hap::GRandomBase& gr
+) {
+	using Gem::Common::GBITSPERWORD;
 
-	return randomized;
+	std::array<std::uint64_t, 64> words{};
+	const std::size_t nBits = this->m_data_cnt.size();
+
+	for(std::size_t blockStart = 0; blockStart < nBits; blockStart += words.size() * GBITSPERWORD) {
+		const std::size_t nBlockBits = (std::min)(words.size() * GBITSPERWORD, nBits - blockStart);
+		gr.fill_bernoulli_words(words.data(), (nBlockBits + GBITSPERWORD - 1) / GBITSPERWORD, probability);
+
+		for(std::size_t b = 0; b < nBlockBits; b++) {
+			this->m_data_cnt[blockStart + b] = (words[b / GBITSPERWORD] >> (b % GBITSPERWORD)) & std::uint64_t(1);
+		}
+	}
 }
 
 /******************************************************************************/
@@ -800,6 +805,62 @@ void GBooleanCollection::specificTestsNoFailureExpected_GUnitTests_() {
 
 	// --------------------------------------------------------------------------
 
+	{ // Check that word-wise adaption flips the expected number of bits
+		const std::size_t nBits = nItems + 13;
+
+		// Counts the positions in which two collections differ
+		auto nDifferent = [](const GBooleanCollection& x, const GBooleanCollection& y) -> std::size_t {
+			std::size_t nDiff = 0;
+			for (std::size_t i = 0; i < x.size(); i++) {
+				if (x.at(i) != y.at(i)) nDiff++;
+			}
+			return nDiff;
+		};
+
+		std::shared_ptr <GBooleanCollection> p_test1 = this->clone<GBooleanCollection>();
+		BOOST_CHECK_NO_THROW(p_test1->clear());
+		for (std::size_t i = 0; i < nBits; i++) {
+			p_test1->push_back(i % 3 == 0);
+		}
+
+		// The test adaptor always adapts bit by bit, so all bits need to be flipped
+		std::shared_ptr <GBooleanCollection> p_test2 = p_test1->clone<GBooleanCollection>();
+		std::size_t nAdapted = 0;
+		BOOST_CHECK_NO_THROW(nAdapted = p_test2->adapt(gr));
+		BOOST_CHECK(nAdapted == nBits);
+		BOOST_CHECK(nDifferent(*p_test2, *p_test1) == nBits);
+
+		// The same needs to hold for an adaptor that always adapts word-wise
+		std::shared_ptr <GBooleanAdaptor> gba_always_ptr(new GBooleanAdaptor());
+		gba_always_ptr->setAdaptionThreshold(0);
+		gba_always_ptr->setAdaptionMode(adaptionMode::ALWAYS);
+		gba_always_ptr->setAdaptBitsWordWise(true);
+		std::shared_ptr <GBooleanCollection> p_test4 = p_test1->clone<GBooleanCollection>();
+		BOOST_CHECK_NO_THROW(p_test4->addAdaptor(gba_always_ptr));
+		BOOST_CHECK_NO_THROW(nAdapted = p_test4->adapt(gr));
+		BOOST_CHECK(nAdapted == nBits);
+		BOOST_CHECK(nDifferent(*p_test4, *p_test1) == nBits);
+
+		// Word-wise adaption with a given probability flips roughly that share of bits
+		const double adProb = 0.5;
+		std::shared_ptr <GBooleanAdaptor> gba_prob_ptr(new GBooleanAdaptor(adProb));
+		gba_prob_ptr->setAdaptionThreshold(0);
+		gba_prob_ptr->setAdaptionMode(adaptionMode::WITHPROBABILITY);
+		gba_prob_ptr->setAdaptBitsWordWise(true);
+		std::shared_ptr <GBooleanCollection> p_test3 = p_test1->clone<GBooleanCollection>();
+		BOOST_CHECK_NO_THROW(p_test3->addAdaptor(gba_prob_ptr));
+
+		BOOST_CHECK_NO_THROW(nAdapted = p_test3->adapt(gr));
+		BOOST_CHECK(nDifferent(*p_test3, *p_test1) == nAdapted);
+		BOOST_CHECK_MESSAGE(
+			double(nAdapted) > LOWERBND * adProb * double(nBits) && double(nAdapted) < UPPERBND * adProb * double(nBits), "\n"
+			<< "nAdapted = " << nAdapted << "\n"
+			<< "nBits = " << nBits << "\n"
+		);
+	}
+
+	// --------------------------------------------------------------------------
+
 	// Remove the test adaptor
 	this->resetAdaptor();
 
@@ -118,10 +118,7 @@ std::string GConstrainedDoubleCollection::name_() const {
 void GConstrainedDoubleCollection::doubleStreamline(
 	std::vector<double> &parVec, const activityMode &am
 ) const {
-	GConstrainedDoubleCollection::const_iterator cit;
-	for (cit = this->begin(); cit != this->end(); ++cit) {
-		parVec.push_back(this->transfer(*cit));
-	}
+	this->appendTransferredValues(parVec);
 }
 
 /******************************************************************************/
@@ -436,6 +433,45 @@ void GConstrainedDoubleCollection::specificTestsNoFailureExpected_GUnitTests_()
 
 	//---------------------------------------------------------------------
 
+	{ // Check that the batch transfer yields bit-identical results to the element-wise transfer
+		std::shared_ptr <GConstrainedDoubleCollection> p_test;
+
+		BOOST_CHECK_NO_THROW(p_test = std::shared_ptr<GConstrainedDoubleCollection>(
+			new GConstrainedDoubleCollection(DEFSIZE, DEFMIN, DEFMAX)));
+
+		Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMLOCAL> gr;
+		std::uniform_real_distribution<double> uniform_real(1000.*DEFMIN, 1000.*DEFMAX);
+
+		std::vector<double> in(1000), out(1000);
+		for(auto& v: in) v = uniform_real(gr);
+		// Include the boundaries and values whose region exceeds the range of std::int32_t
+		in[0] = DEFMIN;
+		in[1] = p_test->getUpperBoundary();
+		in[2] = DEFMAX;
+		in[3] = 1.e12;
+		in[4] = -1.e12;
+
+		BOOST_CHECK_NO_THROW(p_test->transferBatch(in.data(), out.data(), in.size()));
+		for(std::size_t i = 0; i < in.size(); i++) {
+			double expected = 0.;
+			BOOST_CHECK_NO_THROW(expected = p_test->transfer(in[i]));
+			BOOST_CHECK(std::isfinite(out[i]));
+			BOOST_CHECK_MESSAGE(
+				out[i] == expected
+				, "\n"
+				<< "in = " << in[i] << "\n"
+				<< "batch = " << out[i] << "\n"
+				<< "scalar = " << expected << "\n"
+			);
+		}
+
+		// In-place transformation yields the same results
+		BOOST_CHECK_NO_THROW(p_test->transferBatch(in.data(), in.data(), in.size()));
+		BOOST_CHECK(in == out);
+	}
+
+	//---------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GConstrainedDoubleCollection::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
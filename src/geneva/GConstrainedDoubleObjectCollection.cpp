@@ -247,6 +247,65 @@ void GConstrainedDoubleObjectCollection::specificTestsNoFailureExpected_GUnitTes
 
     // --------------------------------------------------------------------------
 
+    { // Test that the stored objects may share a single adaptor
+        std::shared_ptr<GConstrainedDoubleObjectCollection> p_test1 = this->clone<GConstrainedDoubleObjectCollection>();
+
+        // Fill p_test1 with objects. Each of them holds its own adaptor
+        BOOST_CHECK_NO_THROW(p_test1->fillWithObjects_(nAddedObjects));
+        BOOST_CHECK(not p_test1->getShareAdaptors());
+        BOOST_CHECK(p_test1->at(0)->getAdaptor().get() != p_test1->at(1)->getAdaptor().get());
+
+        // Let all objects share the adaptor of the first object
+        BOOST_CHECK_NO_THROW(p_test1->setShareAdaptors(true));
+        BOOST_CHECK(p_test1->getShareAdaptors());
+        GAdaptorT<double> *adaptor_ptr = p_test1->at(0)->getAdaptor().get();
+        for (std::size_t i = 1; i < nAddedObjects; i++) {
+            BOOST_CHECK(p_test1->at(i)->getAdaptor().get() == adaptor_ptr);
+        }
+
+        // Copies receive a common adaptor of their own
+        std::shared_ptr<GConstrainedDoubleObjectCollection> p_test2 = p_test1->clone<GConstrainedDoubleObjectCollection>();
+        BOOST_CHECK(*p_test2 == *p_test1);
+        BOOST_CHECK(p_test2->getShareAdaptors());
+        GAdaptorT<double> *cp_adaptor_ptr = p_test2->at(0)->getAdaptor().get();
+        BOOST_CHECK(cp_adaptor_ptr != adaptor_ptr);
+
+        // Adaptions leave the groups intact and do not affect the original
+        std::shared_ptr<GConstrainedDoubleObjectCollection> p_test1_cp = p_test1->clone<GConstrainedDoubleObjectCollection>();
+        for (std::size_t t = 0; t < nTests; t++) {
+            BOOST_CHECK_NO_THROW(p_test2->adapt(gr));
+        }
+        BOOST_CHECK(*p_test1 == *p_test1_cp);
+        for (std::size_t i = 0; i < nAddedObjects; i++) {
+            BOOST_CHECK(p_test2->at(i)->getAdaptor().get() == cp_adaptor_ptr);
+        }
+
+        // Outstanding handles to the common adaptor do not dissolve the group
+        {
+            std::shared_ptr<GAdaptorT<double>> handle = p_test2->at(0)->getAdaptor();
+            BOOST_CHECK_NO_THROW(p_test2->adapt(gr));
+            for (std::size_t i = 0; i < nAddedObjects; i++) {
+                BOOST_CHECK(p_test2->at(i)->getAdaptor().get() == cp_adaptor_ptr);
+            }
+        }
+
+        // The adaptor of the original was shared with its copies. Its group receives
+        // a single new common adaptor once one of its members is about to modify it
+        GAdaptorT<double> *new_adaptor_ptr = p_test1->at(0)->getAdaptor().get();
+        BOOST_CHECK(new_adaptor_ptr != adaptor_ptr);
+        BOOST_CHECK(new_adaptor_ptr != cp_adaptor_ptr);
+        for (std::size_t i = 1; i < nAddedObjects; i++) {
+            BOOST_CHECK(p_test1->at(i)->getAdaptor().get() == new_adaptor_ptr);
+        }
+
+        // Without sharing, objects receive their own adaptor once they modify it
+        BOOST_CHECK_NO_THROW(p_test2->setShareAdaptors(false));
+        BOOST_CHECK_NO_THROW(p_test2->adapt(gr));
+        BOOST_CHECK(p_test2->at(0)->getAdaptor().get() != p_test2->at(1)->getAdaptor().get());
+    }
+
+    // --------------------------------------------------------------------------
+
     { // Test the GParameterTCollectionT<T>::adapt implementation
         std::shared_ptr<GConstrainedDoubleObjectCollection> p_test1 = this->clone<GConstrainedDoubleObjectCollection>();
         std::shared_ptr<GConstrainedDoubleObjectCollection> p_test2 = this->clone<GConstrainedDoubleObjectCollection>();
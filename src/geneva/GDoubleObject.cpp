@@ -490,6 +490,37 @@ void GDoubleObject::specificTestsNoFailureExpected_GUnitTests_() {
 		BOOST_CHECK_NO_THROW(p_test->getAdaptor<GDoubleGaussAdaptor>());
 	}
 
+	// --------------------------------------------------------------------------
+
+	{ // Test that adaptors shared between copies are copied before they are modified
+		std::shared_ptr <GDoubleObject> p_orig = this->clone<GDoubleObject>();
+		BOOST_CHECK_NO_THROW(p_orig->getAdaptor()->setAdaptionProbability(0.5));
+		// p_orig owns its adaptor at this point. Any later call to getAdaptor() on
+		// p_orig would give it a private copy, so the address is recorded now.
+		const GAdaptorT<double> *p_orig_adaptor = p_orig->getAdaptor().get();
+		std::shared_ptr <GDoubleObject> p_orig_cp = p_orig->clone<GDoubleObject>();
+
+		// Modification through getAdaptor() does not reach the original object
+		std::shared_ptr <GDoubleObject> p_test1 = p_orig->clone<GDoubleObject>();
+		BOOST_CHECK_NO_THROW(p_test1->getAdaptor()->setAdaptionProbability(0.25));
+		BOOST_CHECK(*p_orig == *p_orig_cp);
+		BOOST_CHECK(p_test1->getAdaptor()->getAdaptionProbability() == 0.25);
+
+		// Neither does adaption of an object that has loaded the original
+		std::shared_ptr <GDoubleObject> p_test2 = this->clone<GDoubleObject>();
+		BOOST_CHECK_NO_THROW(p_test2->load(p_orig));
+		for (std::size_t i = 0; i < 10; i++) {
+			BOOST_CHECK_NO_THROW(p_test2->adapt(gr));
+		}
+		BOOST_CHECK(*p_orig == *p_orig_cp);
+		const GAdaptorT<double> *p_test2_adaptor = p_test2->getAdaptor().get();
+		BOOST_CHECK(p_test2_adaptor != p_orig_adaptor);
+
+		// Once the adaptor is owned, further adaptions do not copy it again
+		BOOST_CHECK_NO_THROW(p_test2->adapt(gr));
+		BOOST_CHECK(p_test2->getAdaptor().get() == p_test2_adaptor);
+	}
+
 	// Remove the test adaptor
 	this->resetAdaptor();
 
@@ -58,6 +58,124 @@ void GParameterBase::load_(const GObject *cp) {
 	m_parameterName = p_load->m_parameterName;
 }
 
+/******************************************************************************/
+/**
+ * Adds a description of the structure of this object to a fingerprint. Objects
+ * with identical fingerprints may exchange their data through loadValues().
+ *
+ * @param seed The fingerprint to which the description should be added
+ */
+void GParameterBase::addToFingerprint(std::size_t &seed) const {
+	this->fingerprint_(seed);
+}
+
+/******************************************************************************/
+/**
+ * Loads the data of another object of identical structure, i.e. of an object
+ * with the same fingerprint. Other than load(), this function does not check
+ * the relationship of both objects with dynamic casts, and it re-uses all
+ * existing storage. It is meant for the frequent exchange of data between the
+ * members of a population, which usually stem from a common template.
+ *
+ * Derived classes with local data need to re-implement loadValues_() together
+ * with load_(), as their data would otherwise be skipped. This is checked for
+ * all parameter types by the Geneva standard tests (StandardTests_loadValues),
+ * which compare the results of loadValues() and load() for modified objects.
+ *
+ * @param cp Another GParameterBase object with the same structure as this object
+ */
+void GParameterBase::loadValues(const GParameterBase &cp) {
+	if(typeid(*this) != typeid(cp)) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GParameterBase::loadValues(): Error!" << std::endl
+				<< "Got object of type " << typeid(cp).name() << " for an object of type " << typeid(*this).name() << std::endl
+		);
+	}
+
+	this->loadValues_(cp);
+}
+
+/******************************************************************************/
+/**
+ * Adds all objects holding parameter values (i.e. this object or, for object
+ * collections, the objects stored in it) to a list. The order of the list
+ * matches the order in which values are added by streamline().
+ *
+ * @param leaves The list to which objects holding parameter values should be added
+ */
+void GParameterBase::collectLeaves(std::vector<const GParameterBase *> &leaves) const {
+	this->collectLeaves_(leaves);
+}
+
+/******************************************************************************/
+/**
+ * Adds a description of the structure of this object to a fingerprint. Derived
+ * classes whose structure is not fully described by their type (such as collections)
+ * need to add further information.
+ *
+ * @param seed The fingerprint to which the description should be added
+ */
+void GParameterBase::fingerprint_(std::size_t &seed) const {
+	boost::hash_combine(seed, typeid(*this).hash_code());
+}
+
+/******************************************************************************/
+/**
+ * Loads the data of another object of identical type and structure. Derived
+ * classes with local data need to re-implement this function, load their data
+ * and call their parent's version, just as with load_().
+ *
+ * @param cp Another GParameterBase object of identical type and structure
+ */
+void GParameterBase::loadValues_(const GParameterBase &cp) {
+	m_adaptionsActive = cp.m_adaptionsActive;
+	m_randomInitializationBlocked = cp.m_randomInitializationBlocked;
+	m_parameterName = cp.m_parameterName;
+}
+
+/******************************************************************************/
+/**
+ * Makes this object the first member of an adaptor group. Objects without
+ * adaptors cannot form groups, hence this function does nothing.
+ *
+ * @return false, as there is no adaptor to be shared
+ */
+bool GParameterBase::startAdaptorGroup_() {
+	return false;
+}
+
+/******************************************************************************/
+/**
+ * Lets this object join the adaptor group of another object. Objects without
+ * adaptors cannot join groups, hence this function does nothing.
+ *
+ * @return false, as there is no adaptor to be shared
+ */
+bool GParameterBase::joinAdaptorGroup_(const GParameterBase &) {
+	return false;
+}
+
+/******************************************************************************/
+/**
+ * Lets this object leave its adaptor group. Objects without adaptors never
+ * belong to a group, hence this function does nothing.
+ */
+void GParameterBase::leaveAdaptorGroup_() {
+	/* nothing */
+}
+
+/******************************************************************************/
+/**
+ * Adds this object to the list of objects holding parameter values. Collections
+ * of parameter objects need to re-implement this function.
+ *
+ * @param leaves The list to which objects holding parameter values should be added
+ */
+void GParameterBase::collectLeaves_(std::vector<const GParameterBase *> &leaves) const {
+	leaves.push_back(this);
+}
+
 /******************************************************************************/
 /**
  * Calls the function that does the actual adaption (which is in turn implemented
@@ -97,6 +215,41 @@ void GParameterBase::queryAdaptor(
 	queryAdaptor_(adaptorName, property, data);
 }
 
+/******************************************************************************/
+/**
+ * Makes this object the first member of a group of objects sharing a single
+ * adaptor (see joinAdaptorGroup()). Members of a group adapt their values with
+ * the common adaptor, so that changes of the adaptor (such as of its step width)
+ * resulting from the adaption of one member are visible to all other members.
+ *
+ * @return A boolean indicating whether this object has an adaptor that may be shared
+ */
+bool GParameterBase::startAdaptorGroup() {
+	return startAdaptorGroup_();
+}
+
+/******************************************************************************/
+/**
+ * Lets this object join the adaptor group of another object. This is only
+ * possible if the other object has started or joined a group, and if both
+ * objects use the same parameter and adaptor types.
+ *
+ * @param leader An object belonging to an adaptor group
+ * @return A boolean indicating whether the group was joined
+ */
+bool GParameterBase::joinAdaptorGroup(const GParameterBase &leader) {
+	return joinAdaptorGroup_(leader);
+}
+
+/******************************************************************************/
+/**
+ * Lets this object leave its adaptor group. The adaptor will be copied once
+ * the object is about to modify it.
+ */
+void GParameterBase::leaveAdaptorGroup() {
+	leaveAdaptorGroup_();
+}
+
 /******************************************************************************/
 /**
  * Switches on adaptions for this object
@@ -225,6 +225,7 @@ GParameterSet::GParameterSet(GParameterSet const &cp)
    , m_maxmode(cp.m_maxmode)
    , m_assigned_iteration(cp.m_assigned_iteration)
    , m_validity_level(cp.m_validity_level)
+   , m_validity_level_is_current(cp.m_validity_level_is_current)
    , m_eval_policy(cp.m_eval_policy)
    , m_sigmoid_steepness(cp.m_sigmoid_steepness)
    , m_sigmoid_extremes(cp.m_sigmoid_extremes)
@@ -421,62 +422,15 @@ std::string GParameterSet::toCSV(
 	, bool useRawFitness
 	, bool showValidity
 ) const {
-	std::map<std::string, std::vector<double>> dData;
-	std::map<std::string, std::vector<float>> fData;
-	std::map<std::string, std::vector<std::int32_t>> iData;
-	std::map<std::string, std::vector<bool>> bData;
-
-	// Retrieve the parameter maps
-	this->streamline<double>(dData);
-	this->streamline<float>(fData);
-	this->streamline<std::int32_t>(iData);
-	this->streamline<bool>(bData);
-
 	std::vector<std::string> varNames;
 	std::vector<std::string> varTypes;
 	std::vector<std::string> varValues;
 
-
 	// Extract the data
-	for(auto const & item: dData) {
-		for (std::size_t pos = 0; pos < (item.second).size(); pos++) {
-			if (withNameAndType) {
-				varNames.push_back(item.first + "_" + Gem::Common::to_string(pos));
-				varTypes.emplace_back("double");
-			}
-			varValues.push_back(Gem::Common::to_string((item.second).at(pos)));
-		}
-	}
-
-	for(auto const & item: fData) {
-		for (std::size_t pos = 0; pos < (item.second).size(); pos++) {
-			if (withNameAndType) {
-				varNames.push_back(item.first + "_" + Gem::Common::to_string(pos));
-				varTypes.emplace_back("float");
-			}
-			varValues.push_back(Gem::Common::to_string((item.second).at(pos)));
-		}
-	}
-
-	for(auto const & item: iData) {
-		for (std::size_t pos = 0; pos < (item.second).size(); pos++) {
-			if (withNameAndType) {
-				varNames.push_back(item.first + "_" + Gem::Common::to_string(pos));
-				varTypes.emplace_back("int32");
-			}
-			varValues.push_back(Gem::Common::to_string((item.second).at(pos)));
-		}
-	}
-
-	for(auto const & item: bData) {
-		for (std::size_t pos = 0; pos < (item.second).size(); pos++) {
-			if (withNameAndType) {
-				varNames.push_back(item.first + "_" + Gem::Common::to_string(pos));
-				varTypes.emplace_back("bool");
-			}
-			varValues.push_back(Gem::Common::to_string((item.second).at(pos)));
-		}
-	}
+	this->addCSVData<double>("double", withNameAndType, varNames, varTypes, varValues);
+	this->addCSVData<float>("float", withNameAndType, varNames, varTypes, varValues);
+	this->addCSVData<std::int32_t>("int32", withNameAndType, varNames, varTypes, varValues);
+	this->addCSVData<bool>("bool", withNameAndType, varNames, varTypes, varValues);
 
 	// Note: The following will output the string "dirty" if the individual is in a "dirty" state
 	for (std::size_t i = 0; i < this->getNStoredResults(); i++) {
@@ -640,27 +594,40 @@ std::size_t GParameterSet::getCrossOverPos(
 
 /******************************************************************************/
 /**
- * Perform a fusion operation between this object and another.
+ * Perform a fusion operation between this object and another. The result is
+ * a modified copy of this object (see crossOver()).
+ *
+ * @param cp The object to cross this object with
+ * @return A copy of this object, crossed with cp
  */
 std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GParameterSet> const & cp) const {
 	// Create a copy of this object
 	std::shared_ptr<GParameterSet> this_cp = this->GObject::clone<GParameterSet>();
+	this_cp->crossOver(cp);
+	return this_cp;
+}
 
-	// Extract all data items
-	std::vector<double> this_double_cnt, cp_double_cnt;
-	std::vector<float> this_float_cnt, cp_float_cnt;
-	std::vector<bool> this_bool_cnt, cp_bool_cnt;
-	std::vector<std::int32_t> this_int_cnt, cp_int_cnt;
-
-	this_cp->streamline(this_double_cnt);
-	this_cp->streamline(this_float_cnt);
-	this_cp->streamline(this_bool_cnt);
-	this_cp->streamline(this_int_cnt);
-
-	cp->streamline(cp_double_cnt);
-	cp->streamline(cp_float_cnt);
-	cp->streamline(cp_bool_cnt);
-	cp->streamline(cp_int_cnt);
+/******************************************************************************/
+/**
+ * Performs a fusion operation between this object and another, modifying this
+ * object. Optimization algorithms load a parent into an existing child and then
+ * call this function, so that no new individuals need to be created.
+ *
+ * @param cp The object to cross this object with
+ */
+void GParameterSet::crossOver(std::shared_ptr<GParameterSet> const & cp) {
+	// Extract all data items. The flat views are cached by the individuals, so that
+	// repeated cross-overs do not allocate memory. The views of this object are
+	// written back below.
+	std::vector<double>& this_double_cnt = this->flatValues<double>();
+	std::vector<float>& this_float_cnt = this->flatValues<float>();
+	std::vector<bool>& this_bool_cnt = this->flatValues<bool>();
+	std::vector<std::int32_t>& this_int_cnt = this->flatValues<std::int32_t>();
+
+	const std::vector<double>& cp_double_cnt = cp->flatValues<double>();
+	const std::vector<float>& cp_float_cnt = cp->flatValues<float>();
+	const std::vector<bool>& cp_bool_cnt = cp->flatValues<bool>();
+	const std::vector<std::int32_t>& cp_int_cnt = cp->flatValues<std::int32_t>();
 
 #ifdef DEBUG
 	// Do some error checking
@@ -697,9 +664,7 @@ std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GPar
 	// Do the actual cross-over
 	if (not this_double_cnt.empty()) {
 		// Calculate a suitable position for the cross-over
-		// We use this->cp as the source for getCrossOverPos in order to avoid
-		// having to mark getCrossOverPos const and this m_gr mutable.
-		auto pos = this_cp->getCrossOverPos(1, this_double_cnt.size());
+		auto pos = this->getCrossOverPos(1, this_double_cnt.size());
 
 		// Perform the actual cross-over operation. This is in fact
 		// a "half" cross-over, as we only need one output vector
@@ -708,7 +673,7 @@ std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GPar
 
 	if (not this_float_cnt.empty()) {
 		// Calculate a suitable position for the cross-over
-		auto pos = this_cp->getCrossOverPos(1, this_float_cnt.size());
+		auto pos = this->getCrossOverPos(1, this_float_cnt.size());
 
 		// Perform the actual cross-over operation. This is in fact
 		// a "half" cross-over, as we only need one output vector
@@ -717,7 +682,7 @@ std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GPar
 
 	if (not this_bool_cnt.empty()) {
 		// Calculate a suitable position for the cross-over
-		auto pos = this_cp->getCrossOverPos(1, this_bool_cnt.size());
+		auto pos = this->getCrossOverPos(1, this_bool_cnt.size());
 
 		// Perform the actual cross-over operation. This is in fact
 		// a "half" cross-over, as we only need one output vector
@@ -726,7 +691,7 @@ std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GPar
 
 	if (not this_int_cnt.empty()) {
 		// Calculate a suitable position for the cross-over
-		auto pos = this_cp->getCrossOverPos(1, this_int_cnt.size());
+		auto pos = this->getCrossOverPos(1, this_int_cnt.size());
 
 		// Perform the actual cross-over operation. This is in fact
 		// a "half" cross-over, as we only need one output vector
@@ -734,15 +699,13 @@ std::shared_ptr<GParameterSet> GParameterSet::crossOverWith(std::shared_ptr<GPar
 	}
 
 	// Load the data vectors back into this object
-	this_cp->assignValueVector(this_double_cnt);
-	this_cp->assignValueVector(this_float_cnt);
-	this_cp->assignValueVector(this_bool_cnt);
-	this_cp->assignValueVector(this_int_cnt);
+	this->assignFlatValues<double>();
+	this->assignFlatValues<float>();
+	this->assignFlatValues<bool>();
+	this->assignFlatValues<std::int32_t>();
 
 	// Mark this individual as "dirty"
-	this_cp->mark_as_due_for_processing();
-
-	return this_cp;
+	this->mark_as_due_for_processing();
 }
 
 /******************************************************************************/
@@ -854,6 +817,11 @@ std::size_t GParameterSet::adapt() {
 		this->mark_as_due_for_processing();
 	}
 
+	// The last constraint check was done for the current parameter values, so
+	// process_() does not need to repeat it
+	m_validity_level = validity;
+	m_validity_level_is_current = true;
+
 	// Store the number of adaptions for later use and let the audience know
 	return (m_n_adaptions=nAdaptions);
 }
@@ -1093,6 +1061,24 @@ std::size_t GParameterSet::getNAdaptions() const {
 	return m_n_adaptions;
 }
 
+/******************************************************************************/
+/**
+ * Calculates a fingerprint of the structure of this object, i.e. of the types
+ * and sizes of all parameter objects stored in it, but not of their values.
+ * Two objects with identical fingerprints may exchange their values without
+ * re-creating the parameter objects (see GParameterBase::loadValues()).
+ *
+ * @return A fingerprint of the structure of this object
+ */
+std::size_t GParameterSet::structuralFingerprint() const {
+	std::size_t seed = 0;
+	boost::hash_combine(seed, this->size());
+	for(const auto& item_ptr: *this) {
+		item_ptr->addToFingerprint(seed);
+	}
+	return seed;
+}
+
 /******************************************************************************/
 /**
  * Allows to set the current iteration of the parent optimization algorithm.
@@ -1123,6 +1109,21 @@ std::uint32_t GParameterSet::getAssignedIteration() const {
  * ----------------------------------------------------------------------------------
  */
 
+/******************************************************************************/
+/**
+ * Positions the local random number stream at the start of the stream
+ * identified by (seed, stream). All subsequent random numbers drawn by this
+ * object (e.g. in adapt()) are then a deterministic function of these values,
+ * rather than being taken from the random number factory. Note that the stream
+ * is not copied or serialized along with the object.
+ *
+ * @param seed The seed of the stream
+ * @param stream The id of the stream
+ */
+void GParameterSet::setRandomStream(std::uint64_t seed, std::uint64_t stream) {
+	m_gr.reseed(seed, stream);
+}
+
 /******************************************************************************/
 /**
  * Allows to specify the number of optimization cycles without improvement of the primary fitness criterion
@@ -1411,6 +1412,9 @@ void GParameterSet::registerConstraint(
 
 	// We store clones, so individual objects do not share the same object
 	m_individual_constraint_ptr = c_ptr->GObject::clone<GPreEvaluationValidityCheckT<GParameterSet>>();
+
+	// Any cached validity level refers to the old constraint
+	m_validity_level_is_current = false;
 }
 
 /******************************************************************************/
@@ -1430,6 +1434,16 @@ evaluationPolicy GParameterSet::getEvaluationPolicy() const {
 }
 
 
+/******************************************************************************/
+/**
+ * Called by GProcessingContainerT whenever this individual is marked as due for
+ * processing. As this is done whenever parameter values are changed, the cached
+ * validity level is discarded.
+ */
+void GParameterSet::markedAsDueForProcessing_() {
+	m_validity_level_is_current = false;
+}
+
 /******************************************************************************/
 /**
  * Checks whether this solution is valid. This function is meant to be called
@@ -1517,7 +1531,7 @@ void GParameterSet::process_() {
 
 	// Find out, whether this is a valid solution
 	if (
-		this->parameterSetFulfillsConstraints(m_validity_level) // Needs to be called first, or else the m_validity_level will not be filled
+		this->updateValidityLevel() // Needs to be called first, or else the m_validity_level will not be filled
 		|| evaluationPolicy::USESIMPLEEVALUATION == m_eval_policy
 	) {
 		// Trigger actual fitness calculation using the user-supplied function. This will
@@ -1601,7 +1615,15 @@ void GParameterSet::load_(const GObject *cp) {
 
 	// Load the parent class'es data
 	GObject::load_(cp);
-	Gem::Common::GPtrVectorT<GParameterBase, GObject>::operator=(*p_load);
+	if(this->size() == p_load->size() && this->structuralFingerprint() == p_load->structuralFingerprint()) {
+		// Identically structured individuals (the common case inside of a population) only
+		// need to exchange values -- no parameter objects need to be destroyed or cloned
+		for(std::size_t i=0; i<this->size(); i++) {
+			this->at(i)->loadValues(*((*p_load)[i]));
+		}
+	} else {
+		Gem::Common::GPtrVectorT<GParameterBase, GObject>::operator=(*p_load);
+	}
 	Gem::Courtier::GProcessingContainerT<GParameterSet, parameterset_processing_result>::load_pc(p_load);
 
 	// and then our local data
@@ -1610,6 +1632,7 @@ void GParameterSet::load_(const GObject *cp) {
 	m_maxmode = p_load->m_maxmode;
 	m_assigned_iteration = p_load->m_assigned_iteration;
 	m_validity_level = p_load->m_validity_level;
+	m_validity_level_is_current = p_load->m_validity_level_is_current;
 	m_eval_policy = p_load->m_eval_policy;
 	m_sigmoid_steepness = p_load->m_sigmoid_steepness;
 	m_sigmoid_extremes = p_load->m_sigmoid_extremes;
@@ -1692,7 +1715,7 @@ void GParameterSet::setFitness_(std::vector<double> const & f_cnt) {
 
 	// Find out, whether this is a valid solution
 	if (
-		this->parameterSetFulfillsConstraints(m_validity_level) // Needs to be called first, or else the m_validity_level will not be filled
+		this->updateValidityLevel() // Needs to be called first, or else the m_validity_level will not be filled
 		|| evaluationPolicy::USESIMPLEEVALUATION == m_eval_policy
 	) {
 	   // Create a vector of parameterset_processing_result objects
@@ -1843,6 +1866,23 @@ bool GParameterSet::parameterSetFulfillsConstraints(double &validityLevel) const
 	return false;
 }
 
+/******************************************************************************/
+/**
+ * Updates m_validity_level, unless it was already calculated for the current
+ * parameter values (e.g. in the last round of adapt()). Valid individuals are
+ * thus not checked twice.
+ *
+ * @return A boolean indicating whether this solution fulfills the constraints
+ */
+bool GParameterSet::updateValidityLevel() {
+	if (not m_validity_level_is_current) {
+		this->parameterSetFulfillsConstraints(m_validity_level);
+		m_validity_level_is_current = true;
+	}
+
+	return (m_validity_level <= 1.);
+}
+
 /******************************************************************************/
 /**
  * Retrieves a parameter of a given type at the specified position
@@ -2060,6 +2100,129 @@ void GParameterSet::specificTestsNoFailureExpected_GUnitTests_() {
 
 		//-----------------------------------------------------------------
 
+		{ // Test that flat views match streamline() and may be used to modify the parameters
+			std::shared_ptr<GParameterSet> p_test = p_test_0->clone<GParameterSet>();
+
+			std::vector<double> streamlined;
+			BOOST_CHECK_NO_THROW(p_test->streamline<double>(streamlined, activityMode::ALLPARAMETERS));
+
+			// Assigning without prior extraction is an error
+			BOOST_CHECK_THROW(p_test->assignFlatValues<double>(), gemfony_exception);
+
+			std::vector<double>& flat = p_test->flatValues<double>(activityMode::ALLPARAMETERS);
+			BOOST_CHECK(flat == streamlined);
+
+			// Each parameter object has an entry in the index map, plus the total size
+			std::vector<std::size_t> const& offsets = p_test->flatOffsets<double>();
+			BOOST_REQUIRE(offsets.size() == p_test->size() + 1);
+			BOOST_CHECK(offsets.back() == flat.size());
+			for (std::size_t i = 0; i < p_test->size(); i++) {
+				BOOST_CHECK(offsets[i+1] - offsets[i] == p_test->at(i)->countParameters<double>(activityMode::ALLPARAMETERS));
+			}
+
+			// Repeated extraction re-uses the cached array
+			const double *flat_data = flat.data();
+			BOOST_CHECK(p_test->flatValues<double>(activityMode::ALLPARAMETERS).data() == flat_data);
+
+			// Modifications reach the parameter objects through assignFlatValues()
+			for (auto& d: flat) d /= 2.;
+			BOOST_CHECK_NO_THROW(p_test->assignFlatValues<double>());
+
+			std::vector<double> modified;
+			BOOST_CHECK_NO_THROW(p_test->streamline<double>(modified, activityMode::ALLPARAMETERS));
+			BOOST_REQUIRE(modified.size() == flat.size());
+			for (std::size_t i = 0; i < flat.size(); i++) {
+				BOOST_CHECK(std::fabs(modified[i] - flat[i]) < 1e-10);
+			}
+
+			// Copies start out without a cached view
+			std::shared_ptr<GParameterSet> p_test_cp = p_test->clone<GParameterSet>();
+			BOOST_CHECK(p_test_cp->flatOffsets<double>().empty());
+		}
+
+		//-----------------------------------------------------------------
+
+		{ // Test that the name table gives access to the same values as the name-based streamline()
+			std::shared_ptr<GParameterSet> p_test = p_test_0->clone<GParameterSet>();
+
+			std::map<std::string, std::vector<double>> dMap;
+			BOOST_CHECK_NO_THROW(p_test->streamline<double>(dMap));
+
+			std::vector<double> dVec;
+			BOOST_CHECK_NO_THROW(p_test->streamline<double>(dVec));
+			auto nameTable = p_test->parameterNameTable<double>();
+
+			std::size_t nValues = 0;
+			for (const auto &entry: nameTable) {
+				BOOST_CHECK(std::get<1>(entry) == nValues);
+				nValues += std::get<2>(entry);
+
+				std::vector<double> const &mapValues = Gem::Common::getMapItem(dMap, std::get<0>(entry));
+				BOOST_REQUIRE(mapValues.size() == std::get<2>(entry));
+				for (std::size_t pos = 0; pos < std::get<2>(entry); pos++) {
+					BOOST_CHECK(mapValues.at(pos) == dVec.at(std::get<1>(entry) + pos));
+				}
+			}
+			BOOST_CHECK(nValues == dVec.size());
+			BOOST_CHECK(p_test->getVariableNames<double>().size() == dMap.size());
+
+			// Repeated extraction into the same vector does not re-allocate
+			const double *dVec_data = dVec.data();
+			BOOST_CHECK_NO_THROW(p_test->randomInit(activityMode::ALLPARAMETERS));
+			BOOST_CHECK_NO_THROW(p_test->streamline<double>(dVec));
+			BOOST_CHECK(dVec.data() == dVec_data);
+			BOOST_CHECK(dVec.size() == nValues);
+		}
+
+		//-----------------------------------------------------------------
+
+		{ // Test that identically structured objects are loaded in place
+			std::shared_ptr<GParameterSet> p_test_1 = p_test_0->clone<GParameterSet>();
+			std::shared_ptr<GParameterSet> p_test_2 = p_test_0->clone<GParameterSet>();
+
+			// Clones share the structure of the original
+			BOOST_CHECK(p_test_1->structuralFingerprint() == p_test_0->structuralFingerprint());
+			BOOST_CHECK(p_test_2->structuralFingerprint() == p_test_0->structuralFingerprint());
+
+			// Values do not enter the fingerprint
+			BOOST_CHECK_NO_THROW(p_test_1->randomInit(activityMode::ALLPARAMETERS));
+			BOOST_CHECK(p_test_1->structuralFingerprint() == p_test_2->structuralFingerprint());
+
+			// Loading identically structured objects keeps the parameter objects
+			std::vector<GParameterBase *> parameter_objects;
+			for (const auto& item_ptr: *p_test_2) parameter_objects.push_back(item_ptr.get());
+			BOOST_CHECK_NO_THROW(p_test_2->load(p_test_1));
+			BOOST_CHECK(*p_test_2 == *p_test_1);
+			for (std::size_t i = 0; i < p_test_2->size(); i++) {
+				BOOST_CHECK(p_test_2->at(i).get() == parameter_objects.at(i));
+			}
+
+			// A change of the structure results in a different fingerprint and a full load
+			p_test_1->push_back(std::shared_ptr<GBooleanObject>(new GBooleanObject(false)));
+			BOOST_CHECK(p_test_1->structuralFingerprint() != p_test_2->structuralFingerprint());
+			BOOST_CHECK_NO_THROW(p_test_2->load(p_test_1));
+			BOOST_CHECK(*p_test_2 == *p_test_1);
+		}
+
+		//-----------------------------------------------------------------
+
+		{ // Test that the validity level is only recalculated after parameter values have changed
+			std::shared_ptr<GParameterSet> p_test = p_test_0->clone<GParameterSet>();
+
+			BOOST_CHECK_NO_THROW(p_test->mark_as_due_for_processing());
+			BOOST_CHECK(not p_test->m_validity_level_is_current);
+
+			// No constraint has been registered, so the individual is valid
+			BOOST_CHECK(p_test->updateValidityLevel());
+			BOOST_CHECK(p_test->m_validity_level_is_current);
+
+			// Changing the parameter values invalidates the cached level
+			BOOST_CHECK(p_test->randomInit(activityMode::ALLPARAMETERS));
+			BOOST_CHECK(not p_test->m_validity_level_is_current);
+		}
+
+		//-----------------------------------------------------------------
+
 		{ // Test random initialization
 			// Create a GParameterSet object as a clone of p_test_0 for further usage
 			std::shared_ptr<GParameterSet> p_test = p_test_0->clone<GParameterSet>();
@@ -106,6 +106,16 @@ GParameterSetFormulaConstraint::GParameterSetFormulaConstraint(std::string rawFo
 	: rawFormula_(rawFormula)
 { /* nothing */ }
 
+/******************************************************************************/
+/**
+ * The copy constructor. The compiled formula is not shared with the copy, as
+ * the parser may not be used from more than one thread at the same time.
+ */
+GParameterSetFormulaConstraint::GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &cp)
+	: GParameterSetConstraint(cp)
+	, rawFormula_(cp.rawFormula_)
+{ /* nothing */ }
+
 /******************************************************************************/
 /**
  * Searches for compliance with expectations with respect to another object
@@ -148,9 +158,12 @@ void GParameterSetFormulaConstraint::addConfigurationOptions_(
 
 /******************************************************************************/
 /**
- * This function extracts all double parameter values including their names from the GParameterSet
- * objects. It then initiates replacement of parameter values in the formula string and
- * parsing of the string. If a math error occurs inside of the formula (such as division by 0),
+ * This function extracts all double parameter values from the GParameterSet
+ * objects and hands the values referred to in the formula to the parser. The
+ * formula is parsed only once, and the positions of its variables are only
+ * determined again when the structure of the checked individuals changes.
+ * Individuals of identical structure are assumed to use the same parameter names.
+ * If a math error occurs inside of the formula (such as division by 0),
  * the worst possible value will be returned (MAX_DOUBLE, taken from a Boost function).
  *
  * TODO: Make this work for all parameter types
@@ -158,13 +171,20 @@ void GParameterSetFormulaConstraint::addConfigurationOptions_(
 double GParameterSetFormulaConstraint::check_(
 	const GParameterSet *p
 ) const {
-	std::map<std::string, std::vector<double>> parameterValues;
+	if (not formulaParser_ptr_) {
+		formulaParser_ptr_ = std::make_shared<Gem::Common::GFormulaParserT<double>>(rawFormula_); // Create the parser
+		slotPositionsValid_ = false;
+	}
 
-	p->streamline(parameterValues); // Extract the parameter values including names
-	Gem::Common::GFormulaParserT<double> f(rawFormula_); // Create the parser
+	this->extractValues(p); // Fills parameterValues_ and updates the slot positions, if necessary
+
+	slotValues_.resize(slotPositions_.size());
+	for (std::size_t slot = 0; slot < slotPositions_.size(); slot++) {
+		slotValues_[slot] = parameterValues_[slotPositions_[slot]];
+	}
 
 	try {
-		return f(parameterValues); // Parse the formula. This may throw a Gem::Common::math_logic_error
+		return formulaParser_ptr_->evaluate(slotValues_); // Evaluate the formula. This may throw a Gem::Common::math_logic_error
 	} catch (Gem::Common::math_logic_error &m) {
 		glogger
 		<< "In GParameterSetFormulaConstraint::check_(): WARNING" << std::endl
@@ -177,6 +197,73 @@ double GParameterSetFormulaConstraint::check_(
 	}
 }
 
+/******************************************************************************/
+/**
+ * Extracts the double values of a GParameterSet object into parameterValues_,
+ * walking the parameter objects only once. The position at which each parameter
+ * object's values start is recorded on the way, together with a hash of the
+ * names of all parameter objects. If either differs from the ones seen when the
+ * slot positions were last determined, the structure of the individual has
+ * changed and the slot positions are determined again.
+ */
+void GParameterSetFormulaConstraint::extractValues(const GParameterSet *p) const {
+	parameterValues_.clear();
+	valueOffsets_.clear();
+	leaves_.clear();
+	for (const auto &parm_ptr: *p) {
+		valueOffsets_.push_back(parameterValues_.size());
+		parm_ptr->streamline<double>(parameterValues_, activityMode::DEFAULTACTIVITYMODE);
+		parm_ptr->collectLeaves(leaves_);
+	}
+	valueOffsets_.push_back(parameterValues_.size());
+
+	nameHash_ = 0;
+	for (const auto leaf_ptr: leaves_) {
+		boost::hash_combine(nameHash_, leaf_ptr->getParameterName());
+	}
+
+	if (not slotPositionsValid_ || valueOffsets_ != slotOffsets_ || nameHash_ != slotNameHash_) {
+		this->updateSlotPositions(p);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Determines the positions of the formula's variables in the vector filled by
+ * GParameterSet::streamline(std::vector<double>&). As with the name-based
+ * streamline() function, the last parameter object with a given name takes
+ * precedence.
+ */
+void GParameterSetFormulaConstraint::updateSlotPositions(const GParameterSet *p) const {
+	auto nameTable = p->parameterNameTable<double>();
+
+	slotPositions_.clear();
+	for (const auto &slot_desc: formulaParser_ptr_->getVariableSlots()) {
+		auto entry_it = std::find_if(
+			nameTable.rbegin()
+			, nameTable.rend()
+			, [&slot_desc](const std::tuple<std::string, std::size_t, std::size_t> &entry) -> bool {
+				return std::get<0>(entry) == std::get<0>(slot_desc);
+			}
+		);
+
+		if (entry_it == nameTable.rend() || std::get<1>(slot_desc) >= std::get<2>(*entry_it)) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In GParameterSetFormulaConstraint::updateSlotPositions(): Error!" << std::endl
+					<< "No value found for place holder " << std::get<0>(slot_desc) << "[" << std::get<1>(slot_desc) << "]" << std::endl
+					<< "in formula " << rawFormula_ << std::endl
+			);
+		}
+
+		slotPositions_.push_back(std::get<1>(*entry_it) + std::get<1>(slot_desc));
+	}
+
+	slotOffsets_ = valueOffsets_;
+	slotNameHash_ = nameHash_;
+	slotPositionsValid_ = true;
+}
+
 /******************************************************************************/
 /**
  * Loads the data of another GParameterSetFormulaConstraint
@@ -189,7 +276,13 @@ void GParameterSetFormulaConstraint::load_(const GObject *cp) {
 	GPreEvaluationValidityCheckT<GParameterSet>::load_(cp);
 
 	// ... and then our local data
-	rawFormula_ = p_load->rawFormula_;
+	if (rawFormula_ != p_load->rawFormula_) {
+		rawFormula_ = p_load->rawFormula_;
+
+		// The formula needs to be compiled again
+		formulaParser_ptr_.reset();
+		slotPositionsValid_ = false;
+	}
 }
 
 /******************************************************************************/
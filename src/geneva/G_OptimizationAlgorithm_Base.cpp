@@ -194,6 +194,7 @@ G_OptimizationAlgorithm_Base::G_OptimizationAlgorithm_Base(const G_OptimizationA
 	  , m_maxIteration(cp.m_maxIteration)
 	  , m_maxStallIteration(cp.m_maxStallIteration)
 	  , m_reportIteration(cp.m_reportIteration)
+	  , m_reproducibleSeed(cp.m_reproducibleSeed)
 	  , m_nRecordbestGlobalIndividuals(cp.m_nRecordbestGlobalIndividuals)
 	  , m_bestGlobalIndividuals_pq(cp.m_bestGlobalIndividuals_pq)
 	  , m_bestIterationIndividuals_pq(cp.m_bestIterationIndividuals_pq)
@@ -487,6 +488,7 @@ void G_OptimizationAlgorithm_Base::compare_(
 	compare_t(IDENTITY(m_minIteration, p_load->m_minIteration), token);
 	compare_t(IDENTITY(m_maxStallIteration, p_load->m_maxStallIteration), token);
 	compare_t(IDENTITY(m_reportIteration, p_load->m_reportIteration), token);
+	compare_t(IDENTITY(m_reproducibleSeed, p_load->m_reproducibleSeed), token);
 	compare_t(IDENTITY(m_nRecordbestGlobalIndividuals, p_load->m_nRecordbestGlobalIndividuals), token);
 	compare_t(IDENTITY(m_bestGlobalIndividuals_pq, p_load->m_bestGlobalIndividuals_pq), token);
 	compare_t(IDENTITY(m_bestIterationIndividuals_pq, p_load->m_bestIterationIndividuals_pq), token);
@@ -685,6 +687,14 @@ G_OptimizationAlgorithm_Base const * const G_OptimizationAlgorithm_Base::optimiz
 		// Let all individuals know the current iteration
 		markIteration();
 
+		// In reproducible mode, key the algorithm's own random stream to the iteration
+		if(m_reproducibleSeed) {
+			m_gr.reseed(
+				m_reproducibleSeed
+				, (static_cast<std::uint64_t>(m_iteration) << 32) | REPRODUCIBLEALGORITHMSTREAM
+			);
+		}
+
 		// Update fitness values and the stall counter
 		updateStallCounter((m_bestCurrentPrimaryFitness= cycleLogic_()));
 
@@ -1088,6 +1098,67 @@ std::uint32_t G_OptimizationAlgorithm_Base::getReportIteration() const {
 	return m_reportIteration;
 }
 
+/******************************************************************************/
+/**
+ * Sets the seed of reproducible random streams. With a seed other than 0, the
+ * random numbers drawn by the algorithm itself, during the adaption of
+ * individuals (evolutionary algorithms and simulated annealing) and during
+ * their random initialization by the algorithm (all algorithms) are keyed by
+ * (seed, iteration, population position). Two runs with the same seed then
+ * follow the same trajectory, independent of the number of threads or the
+ * scheduling. Note that this requires the executor to return all items of an
+ * iteration, so the population is the same. Random numbers drawn by user
+ * individuals during their evaluation are not covered. With a seed of 0,
+ * all random numbers are taken from the random number factory.
+ *
+ * @param seed The seed of reproducible random streams (0 disables reproducible mode)
+ */
+void G_OptimizationAlgorithm_Base::setReproducibleSeed(std::uint64_t seed) {
+	m_reproducibleSeed = seed;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the seed of reproducible random streams
+ *
+ * @return The seed of reproducible random streams (0 means: reproducible mode is off)
+ */
+std::uint64_t G_OptimizationAlgorithm_Base::getReproducibleSeed() const {
+	return m_reproducibleSeed;
+}
+
+/******************************************************************************/
+/**
+ * Positions the random stream of an individual according to the current
+ * iteration and its position in the population, if reproducible mode was
+ * requested. This function needs to be called before adaption is scheduled,
+ * in the thread that schedules it.
+ *
+ * @param ind The individual whose random stream should be positioned
+ * @param pos The position of the individual in the population
+ */
+void G_OptimizationAlgorithm_Base::markRandomStream(GParameterSet& ind, std::size_t pos) const {
+	if(not m_reproducibleSeed) return;
+
+	ind.setRandomStream(
+		m_reproducibleSeed
+		, (static_cast<std::uint64_t>(m_iteration) << 32) | static_cast<std::uint32_t>(pos)
+	);
+}
+
+/******************************************************************************/
+/**
+ * Positions the random stream of an individual for its random initialization
+ * by the algorithm, if reproducible mode was requested. The stream differs from
+ * the one used by markRandomStream() for the same iteration and position.
+ *
+ * @param ind The individual whose random stream should be positioned
+ * @param pos The position of the individual in the population
+ */
+void G_OptimizationAlgorithm_Base::markRandomInitStream(GParameterSet& ind, std::size_t pos) const {
+	this->markRandomStream(ind, static_cast<std::uint32_t>(pos) | REPRODUCIBLEINITSTREAMFLAG);
+}
+
 /******************************************************************************/
 /**
  * Retrieves the current number of failed optimization attempts
@@ -1243,6 +1314,16 @@ void G_OptimizationAlgorithm_Base::addConfigurationOptions_ (
 	)
 		<< "The number of iterations after which a report should be issued";
 
+	gpb.registerFileParameter<std::uint64_t>(
+		"reproducibleSeed" // The name of the variable
+		, DEFAULTREPRODUCIBLESEED // The default value
+		, [this](std::uint64_t seed){ this->setReproducibleSeed(seed); }
+	)
+		<< "A value other than 0 keys the random numbers of the algorithm and of" << std::endl
+		<< "the adaption and random initialization of individuals to (seed, iteration," << std::endl
+		<< "population position), so that runs are reproducible across thread counts" << std::endl
+		<< "and execution modes. 0 means: Random numbers are taken from the factory";
+
 	gpb.registerFileParameter<std::size_t>(
 		"nRecordBestIndividuals" // The name of the variable
 		, DEFNRECORDBESTINDIVIDUALS // The default value
@@ -1464,6 +1545,7 @@ void G_OptimizationAlgorithm_Base::load_(const GObject* cp) {
 	m_minIteration = p_load->m_minIteration;
 	m_maxStallIteration = p_load->m_maxStallIteration;
 	m_reportIteration = p_load->m_reportIteration;
+	m_reproducibleSeed = p_load->m_reproducibleSeed;
 	m_nRecordbestGlobalIndividuals = p_load->m_nRecordbestGlobalIndividuals;
 	m_bestGlobalIndividuals_pq = p_load->m_bestGlobalIndividuals_pq;
 	m_bestIterationIndividuals_pq = p_load->m_bestIterationIndividuals_pq;
@@ -441,6 +441,9 @@ void GEvolutionaryAlgorithm::adaptChildren_() {
 
 	// Loop over all requested individuals and perform the adaption
 	for (auto it = (this->begin() + std::get<0>(range)); it != (this->begin() + std::get<1>(range)); ++it) {
+		// Key the random stream of the individual to its position, if requested
+		this->markRandomStream(**it, static_cast<std::size_t>(it - this->begin()));
+
 		futures_cnt.push_back(
 			m_tp_ptr->async_schedule(
 				// Note: may not pass it as a reference, as it is a local variable in the loop and might
@@ -649,8 +652,8 @@ void GEvolutionaryAlgorithm::fixAfterJobSubmission() {
 	if (this->size() < this->getDefaultPopulationSize()) {
 		std::size_t fixSize = this->getDefaultPopulationSize() - this->size();
 		for (std::size_t i = 0; i < fixSize; i++) {
-			// This function will create a clone of its argument
-			this->push_back_clone(this->back());
+			// This function will re-use an individual dropped in an earlier iteration or create a clone of its argument
+			this->push_back_recycled(this->back());
 		}
 	}
 
@@ -751,7 +754,7 @@ void GEvolutionaryAlgorithm::selectBest_() {
 	// At this point we have a sorted list of individuals and can take care of
 	// too many members, so the next iteration finds a "standard" population. This
 	// function will remove the last items.
-	this->resize(this->getNParents() + this->getDefaultNChildren());
+	this->recycleSurplusIndividuals(this->getNParents() + this->getDefaultNChildren());
 
 	// Everything should be back to normal ...
 }
@@ -1288,6 +1291,39 @@ void GEvolutionaryAlgorithm::specificTestsNoFailureExpected_GUnitTests_() {
 
 	//------------------------------------------------------------------------------
 
+	{ // Check that surplus individuals are kept for re-use instead of being destroyed
+		std::shared_ptr <GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(10, 2));
+
+		// Remember the individuals that will be removed from the population
+		std::vector<GParameterSet *> surplus;
+		for(std::size_t pos = 10; pos < 20; pos++) {
+			surplus.push_back(p_test->at(pos).get());
+		}
+
+		BOOST_CHECK_NO_THROW(p_test->recycleSurplusIndividuals(10));
+		BOOST_CHECK(p_test->size() == 10);
+		BOOST_CHECK(p_test->getNRecycledIndividuals() == 10);
+
+		// Refill the population -- recycled individuals must be re-used and become copies of the argument
+		for(std::size_t i = 0; i < 10; i++) {
+			BOOST_CHECK_NO_THROW(p_test->push_back_recycled(p_test->at(0)));
+			BOOST_CHECK(std::find(surplus.begin(), surplus.end(), p_test->back().get()) != surplus.end());
+			BOOST_CHECK(*(p_test->back()) == *(p_test->at(0)));
+		}
+		BOOST_CHECK(p_test->size() == 20);
+		BOOST_CHECK(p_test->getNRecycledIndividuals() == 0);
+
+		// Without recycled individuals, clones are created
+		BOOST_CHECK_NO_THROW(p_test->push_back_recycled(p_test->at(0)));
+		BOOST_CHECK(std::find(surplus.begin(), surplus.end(), p_test->back().get()) == surplus.end());
+		BOOST_CHECK(*(p_test->back()) == *(p_test->at(0)));
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GEvolutionaryAlgorithm::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -329,9 +329,8 @@ std::tuple<double, double> GGradientDescent::cycleLogic_() {
 void GGradientDescent::updateChildParameters() {
 	// Loop over all starting points
 	for (std::size_t i = 0; i < nStartingPoints_; i++) {
-		// Extract the fp vector
-		std::vector<double> parmVec;
-		this->at(i)->streamline<double>(parmVec, activityMode::ACTIVEONLY); // Only extract active parameters
+		// Extract the fp vector (cached by the parent, so no allocation is needed in later iterations)
+		std::vector<double>& parmVec = this->at(i)->flatValues<double>(activityMode::ACTIVEONLY); // Only extract active parameters
 
 		// Loop over all directions
 		for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
@@ -367,8 +366,7 @@ void GGradientDescent::updateChildParameters() {
 void GGradientDescent::updateParentIndividuals() {
 	for (std::size_t i = 0; i < nStartingPoints_; i++) {
 		// Extract the fp vector
-		std::vector<double> parmVec;
-		this->at(i)->streamline<double>(parmVec, activityMode::ACTIVEONLY);
+		std::vector<double>& parmVec = this->at(i)->flatValues<double>(activityMode::ACTIVEONLY);
 
 #ifdef DEBUG
 		// Make sure the parents are clean
@@ -408,7 +406,7 @@ void GGradientDescent::updateParentIndividuals() {
 		}
 
 		// Load the parameter vector back into the parent
-		this->at(i)->assignValueVector<double>(parmVec, activityMode::ACTIVEONLY);
+		this->at(i)->assignFlatValues<double>();
 	}
 }
 
@@ -652,6 +650,7 @@ void GGradientDescent::adjustPopulation_() {
 			// Create a copy of the first individual
 			this->push_back(this->at(0)->clone<GParameterSet>());
 			// Make sure our start values differ
+			this->markRandomInitStream(*(this->back()), this->size() - 1);
 			this->back()->randomInit(activityMode::ACTIVEONLY);
 		}
 	} else {
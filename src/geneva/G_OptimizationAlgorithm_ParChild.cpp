@@ -360,7 +360,9 @@ void G_OptimizationAlgorithm_ParChild::doRecombine() {
 			std::shared_ptr <GParameterSet> bestParent = this->front();
 			std::shared_ptr <GParameterSet> combiner = (m_n_parents > 2) ? (*(this->begin() + this->m_uniform_int_distribution(this->m_gr, std::uniform_int_distribution<std::size_t>::param_type(1, m_n_parents - 1)))) : (*(this->begin() + 1));
 
-			(*it)->GObject::load(bestParent->crossOverWith(combiner));
+			// The child is the target of the cross-over, so no new individual is created
+			(*it)->GObject::load(bestParent);
+			(*it)->crossOver(combiner);
 		} else { // Just perform duplication
 			switch (m_recombination_method) {
 				case duplicationScheme::DEFAULTDUPLICATIONSCHEME: // we want the RANDOMDUPLICATIONSCHEME behavior
@@ -581,6 +583,9 @@ void G_OptimizationAlgorithm_ParChild::init() {
 	// network environment, some individuals might not return and some individuals return
 	// late. The factual size of the population then changes and we need to take action.
 	m_default_n_children = G_OptimizationAlgorithm_Base::getDefaultPopulationSize() - m_n_parents;
+
+	// Start with an empty recycling bin
+	m_recycling_bin.clear();
 }
 
 /******************************************************************************/
@@ -588,6 +593,9 @@ void G_OptimizationAlgorithm_ParChild::init() {
  * Does any necessary finalization work
  */
 void G_OptimizationAlgorithm_ParChild::finalize() {
+	// Recycled individuals are only needed during the optimization cycle
+	m_recycling_bin.clear();
+
 	// Last action
 	G_OptimizationAlgorithm_Base::finalize();
 }
@@ -643,6 +651,7 @@ void G_OptimizationAlgorithm_ParChild::adjustPopulation_() {
 
 		// Randomly initialize new items
 		for(it=G_OptimizationAlgorithm_Base::m_data_cnt.begin()+this_sz; it!=G_OptimizationAlgorithm_Base::m_data_cnt.end(); ++it) {
+			this->markRandomInitStream(**it, static_cast<std::size_t>(it - G_OptimizationAlgorithm_Base::m_data_cnt.begin()));
 			(*it)->randomInit(activityMode::ACTIVEONLY);
 		}
 	}
@@ -662,9 +671,69 @@ void G_OptimizationAlgorithm_ParChild::performScheduledPopulationGrowth() {
 		// Set a new default population size
 		this->setPopulationSizes(this->getDefaultPopulationSize() + m_growth_rate, this->getNParents());
 
-		// Add missing items as copies of the last individual in the list
-		this->resize_clone(G_OptimizationAlgorithm_Base::getDefaultPopulationSize(), G_OptimizationAlgorithm_Base::m_data_cnt[0]);
+		// Add missing items as copies of the first individual in the list
+		while(this->size() < G_OptimizationAlgorithm_Base::getDefaultPopulationSize()) {
+			this->push_back_recycled(G_OptimizationAlgorithm_Base::m_data_cnt[0]);
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * Removes all individuals beyond a given position from the population. Instead of
+ * destroying them, up to getDefaultPopulationSize() of them are kept for re-use by
+ * push_back_recycled(). This avoids the repeated allocation and destruction of
+ * entire parameter trees in each iteration. Individuals still referenced elsewhere
+ * (e.g. by a broker) are simply released.
+ *
+ * @param nominalSize The number of individuals that should remain in the population
+ */
+void G_OptimizationAlgorithm_ParChild::recycleSurplusIndividuals(std::size_t nominalSize) {
+	for(std::size_t pos = nominalSize; pos < this->size(); pos++) {
+		if(m_recycling_bin.size() >= G_OptimizationAlgorithm_Base::getDefaultPopulationSize()) break;
+
+		std::shared_ptr<GParameterSet> const& item_ptr = G_OptimizationAlgorithm_Base::m_data_cnt[pos];
+		if(item_ptr && 1 == item_ptr.use_count()) {
+			m_recycling_bin.push_back(item_ptr);
+		}
 	}
+
+	this->resize(nominalSize);
+}
+
+/******************************************************************************/
+/**
+ * Attaches a copy of an individual to the end of the population. If recycled
+ * individuals are available, one of them is loaded with the data of item_ptr
+ * (which is cheap for identically structured individuals, see GParameterSet::load_()).
+ * Otherwise item_ptr is cloned.
+ *
+ * @param item_ptr The individual whose copy should be attached to the population
+ */
+void G_OptimizationAlgorithm_ParChild::push_back_recycled(std::shared_ptr<GParameterSet> item_ptr) {
+	while(not m_recycling_bin.empty()) {
+		std::shared_ptr<GParameterSet> recycled_ptr = m_recycling_bin.back();
+		m_recycling_bin.pop_back();
+
+		// Individuals may not be shared with other entities (e.g. a copy of this object)
+		if(1 == recycled_ptr.use_count()) {
+			recycled_ptr->GObject::load(item_ptr);
+			this->push_back(recycled_ptr);
+			return;
+		}
+	}
+
+	this->push_back_clone(item_ptr);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of individuals currently held for re-use
+ *
+ * @return The number of individuals currently held for re-use
+ */
+std::size_t G_OptimizationAlgorithm_ParChild::getNRecycledIndividuals() const {
+	return m_recycling_bin.size();
 }
 
 /******************************************************************************/
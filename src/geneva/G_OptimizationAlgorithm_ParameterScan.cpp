@@ -730,6 +730,7 @@ void GParameterScan::randomShuffle() {
 
 	while (true) {
 		// Update the individual and mark it as "dirty"
+		this->markRandomInitStream(*(this->at(indPos)), indPos);
 		this->at(indPos)->randomInit(activityMode::ACTIVEONLY);
 		// Mark the individual as "dirty", so it gets re-evaluated the
 		// next time the fitness() function is called
@@ -345,6 +345,9 @@ void GSimulatedAnnealing::adaptChildren_() {
 
 	// Loop over all requested individuals and perform the adaption
 	for (auto it = (this->begin() + std::get<0>(range)); it != (this->begin() + std::get<1>(range)); ++it) {
+		// Key the random stream of the individual to its position, if requested
+		this->markRandomStream(**it, static_cast<std::size_t>(it - this->begin()));
+
 		futures_cnt.push_back(
 			m_tp_ptr->async_schedule(
 				// Note: may not pass it as a reference, as it is a local variable in the loop and might
@@ -541,8 +544,8 @@ void GSimulatedAnnealing::fixAfterJobSubmission() {
 	if (this->size() < this->getDefaultPopulationSize()) {
 		std::size_t fixSize = this->getDefaultPopulationSize() - this->size();
 		for (std::size_t i = 0; i < fixSize; i++) {
-			// This function will create a clone of its argument
-			this->push_back_clone(this->back());
+			// This function will re-use an individual dropped in an earlier iteration or create a clone of its argument
+			this->push_back_recycled(this->back());
 		}
 	}
 
@@ -587,7 +590,7 @@ void GSimulatedAnnealing::selectBest_() {
 	// At this point we have a sorted list of individuals and can take care of
 	// too many members, so the next iteration finds a "standard" population. This
 	// function will remove the last items.
-	this->resize(this->getNParents() + this->getDefaultNChildren());
+	this->recycleSurplusIndividuals(this->getNParents() + this->getDefaultNChildren());
 
 	// Let children know they are children
 	this->markChildren();
@@ -830,6 +830,7 @@ void GSwarmAlgorithm::adjustNeighborhoods() {
 					m_data_cnt.insert(m_data_cnt.begin() + firstNIPos, (this->front())->clone<GParameterSet>());
 
 					// Randomly initialize the item and prevent position updates
+					this->markRandomInitStream(**(m_data_cnt.begin() + firstNIPos), m_data_cnt.size() - 1);
 					(*(m_data_cnt.begin() + firstNIPos))->randomInit(activityMode::ACTIVEONLY);
 					(*(m_data_cnt.begin() + firstNIPos))->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->setNoPositionUpdate();
 
@@ -1056,14 +1057,24 @@ void GSwarmAlgorithm::updateIndividualPositions(
 
 #endif /* DEBUG */
 
-	// Extract the vectors for the individual, the personal, neighborhood and global bests,
-	// as well as the velocity
-	std::vector<double> indVec, personalBestVec, nbhBestVec, glbBestVec, velVec;
-	ind->streamline(indVec, activityMode::ACTIVEONLY);
-	personal_best->streamline(personalBestVec, activityMode::ACTIVEONLY);
-	neighborhood_best->streamline(nbhBestVec, activityMode::ACTIVEONLY);
-	global_best->streamline(glbBestVec, activityMode::ACTIVEONLY);
-	velocity->streamline(velVec, activityMode::ACTIVEONLY);
+	// Extract the vectors for the individual and the velocity. The flat views are cached
+	// by each individual, so that no memory needs to be allocated here in later iterations.
+	std::vector<double>& indVec = ind->flatValues<double>(activityMode::ACTIVEONLY);
+	std::vector<double>& velVec = velocity->flatValues<double>(activityMode::ACTIVEONLY);
+
+	// The personal, neighborhood and global bests are only read. Their values are copied
+	// into scratch buffers owned by this algorithm, which keep their capacity between calls.
+	const std::vector<double>& personalBestView = personal_best->flatValues<double>(activityMode::ACTIVEONLY);
+	const std::vector<double>& nbhBestView = neighborhood_best->flatValues<double>(activityMode::ACTIVEONLY);
+	const std::vector<double>& glbBestView = global_best->flatValues<double>(activityMode::ACTIVEONLY);
+
+	std::vector<double>& personalBestVec = m_personal_best_scratch_cnt;
+	std::vector<double>& nbhBestVec = m_nbh_best_scratch_cnt;
+	std::vector<double>& glbBestVec = m_glb_best_scratch_cnt;
+
+	personalBestVec.assign(personalBestView.begin(), personalBestView.end());
+	nbhBestVec.assign(nbhBestView.begin(), nbhBestView.end());
+	glbBestVec.assign(glbBestView.begin(), glbBestView.end());
 
 	// Subtract the individual vector from the personal, neighborhood and global bests
 	Gem::Common::subtractVec<double>(personalBestVec, indVec);
@@ -1115,10 +1126,10 @@ void GSwarmAlgorithm::updateIndividualPositions(
 	}
 
 	// Update the velocity individual
-	velocity->assignValueVector<double>(velVec, activityMode::ACTIVEONLY);
+	velocity->assignFlatValues<double>();
 
 	// Update the candidate solution
-	ind->assignValueVector<double>(indVec, activityMode::ACTIVEONLY);
+	ind->assignFlatValues<double>();
 }
 
 /******************************************************************************/
@@ -1398,6 +1409,7 @@ void GSwarmAlgorithm::adjustPopulation_() {
 		// Fill up with random items to the number of neighborhoods
 		for (std::size_t i = 1; i < m_n_neighborhoods; i++) {
 			this->push_back(this->front()->clone<GParameterSet>());
+			this->markRandomInitStream(*(this->back()), this->size() - 1);
 			this->back()->randomInit(activityMode::ACTIVEONLY);
 		}
 
@@ -1418,6 +1430,7 @@ void GSwarmAlgorithm::adjustPopulation_() {
 			// First fill up the neighborhoods, if required
 			for (std::size_t m = 0; m < (m_n_neighborhoods - currentSize); m++) {
 				this->push_back(this->front()->clone<GParameterSet>());
+				this->markRandomInitStream(*(this->back()), this->size() - 1);
 				this->back()->randomInit(activityMode::ACTIVEONLY);
 			}
 
@@ -1513,6 +1526,7 @@ void GSwarmAlgorithm::fillUpNeighborhood1() {
 				}
 #endif /* DEBUG */
 
+				this->markRandomInitStream(**(this->begin() + n + 1), this->size() - 1);
 				(*(this->begin() + n + 1))->randomInit(activityMode::ACTIVEONLY);
 			}
 		}
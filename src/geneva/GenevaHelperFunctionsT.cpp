@@ -36,13 +36,14 @@
 
 #include "geneva/GenevaHelperFunctionsT.hpp"
 #include "geneva/GDoubleGaussAdaptor.hpp"
+#include "geneva/GFloatGaussAdaptor.hpp"
 #include "geneva/GInt32FlipAdaptor.hpp"
 #include "geneva/GBooleanAdaptor.hpp"
 
 namespace Gem {
 namespace Geneva {
 
-// Specializations for double, std::int32_t and bool
+// Specializations for double, float, std::int32_t and bool
 /******************************************************************************/
 /**
  * A factory function that returns the default adaptor for the base type "double"
@@ -54,6 +55,17 @@ std::shared_ptr <GAdaptorT<double>> getDefaultAdaptor<double>() {
 	return std::shared_ptr<GDoubleGaussAdaptor>(new GDoubleGaussAdaptor());
 }
 
+/******************************************************************************/
+/**
+ * A factory function that returns the default adaptor for the base type "float"
+ *
+ * @return The default adaptor for the base type "float"
+ */
+template<>
+std::shared_ptr <GAdaptorT<float>> getDefaultAdaptor<float>() {
+	return std::shared_ptr<GFloatGaussAdaptor>(new GFloatGaussAdaptor());
+}
+
 /******************************************************************************/
 /**
  * A factory function that returns the default adaptor for the base type "std::int32_t"
@@ -44,14 +44,24 @@ namespace Geneva {
  * Set a number of parameters of the random number factory
  *
  * @param nProducerThreads The number of threads simultaneously producing random numbers
+ * @param arraySize The number of random numbers in each package
+ * @param bufferSize The number of packages held in the buffers of the factory
+ * @param useHugePages Whether large packages should be backed by huge pages
  */
 void setRNFParameters(
 	std::uint16_t nProducerThreads
+	, std::size_t arraySize
+	, std::size_t bufferSize
+	, bool useHugePages
 ) {
 	//--------------------------------------------
 	// Random numbers are our most valuable good.
-	// Set the number of threads. GRANDOMFACTORY is
-	// a singleton that will be initialized by this call.
+	// Set the package layout first, so that producer
+	// threads start with the desired settings. GRANDOMFACTORY
+	// is a singleton that will be initialized by this call.
+	GRANDOMFACTORY->setArraySize(arraySize);
+	GRANDOMFACTORY->setBufferSize(bufferSize);
+	GRANDOMFACTORY->setUseHugePages(useHugePages);
 	GRANDOMFACTORY->setNProducerThreads(nProducerThreads);
 }
 
@@ -110,7 +120,14 @@ Go2::Go2(
 	//--------------------------------------------
 	// Random numbers are our most valuable good.
 	// Initialize all necessary variables
-	std::call_once(f_go2, [this](){ setRNFParameters(this->m_n_producer_threads); });
+	std::call_once(f_go2, [this](){
+		setRNFParameters(
+			this->m_n_producer_threads
+			, this->m_rnf_array_size
+			, this->m_rnf_buffer_size
+			, this->m_rnf_use_huge_pages
+		);
+	});
 }
 
 /******************************************************************************/
@@ -697,6 +714,29 @@ void Go2::addConfigurationOptions_(
     )
             << "The number of threads simultaneously producing random numbers";
 
+    gpb.registerFileParameter<std::size_t>(
+            "rnfArraySize"
+            , GO2_DEF_RNFARRAYSIZE
+            , [this](std::size_t as) { this->setRNFArraySize(as); }
+    )
+            << "The number of random numbers in each package handed out by the random number factory." << std::endl
+            << "Larger packages reduce buffer traffic for heavy consumers, smaller ones save memory";
+
+    gpb.registerFileParameter<std::size_t>(
+            "rnfBufferSize"
+            , GO2_DEF_RNFBUFFERSIZE
+            , [this](std::size_t bs) { this->setRNFBufferSize(bs); }
+    )
+            << "The maximum number of random number packages held in the buffers of the random number factory";
+
+    gpb.registerFileParameter<bool>(
+            "rnfUseHugePages"
+            , GO2_DEF_RNFHUGEPAGES
+            , [this](bool hp) { this->setRNFUseHugePages(hp); }
+    )
+            << "Whether random number packages of at least 2 MB should be backed by huge pages" << std::endl
+            << "(only supported on Linux)";
+
     gpb.registerFileParameter<bool>(
             "copyBestIndividualsOnly"
             , GO2_DEF_COPYBESTINDIVIDUALSONLY
@@ -755,6 +795,70 @@ std::uint16_t Go2::getNProducerThreads() const {
 	return m_n_producer_threads;
 }
 
+/******************************************************************************/
+/**
+ * Allows to set the number of random numbers in each package of the random
+ * number factory. The setting takes effect when the factory is configured.
+ *
+ * @param arraySize The number of random numbers in each package
+ */
+void Go2::setRNFArraySize(std::size_t arraySize) {
+	m_rnf_array_size = arraySize;
+}
+
+/******************************************************************************/
+/**
+ * Allows to retrieve the number of random numbers in each package of the
+ * random number factory
+ *
+ * @return The number of random numbers in each package
+ */
+std::size_t Go2::getRNFArraySize() const {
+	return m_rnf_array_size;
+}
+
+/******************************************************************************/
+/**
+ * Allows to set the number of packages held in the buffers of the random
+ * number factory
+ *
+ * @param bufferSize The number of packages held in the buffers of the factory
+ */
+void Go2::setRNFBufferSize(std::size_t bufferSize) {
+	m_rnf_buffer_size = bufferSize;
+}
+
+/******************************************************************************/
+/**
+ * Allows to retrieve the number of packages held in the buffers of the random
+ * number factory
+ *
+ * @return The number of packages held in the buffers of the factory
+ */
+std::size_t Go2::getRNFBufferSize() const {
+	return m_rnf_buffer_size;
+}
+
+/******************************************************************************/
+/**
+ * Specifies whether large random number packages should be backed by huge pages
+ *
+ * @param useHugePages Whether large packages should be backed by huge pages
+ */
+void Go2::setRNFUseHugePages(bool useHugePages) {
+	m_rnf_use_huge_pages = useHugePages;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether large random number packages should be backed by huge pages
+ *
+ * @return Whether large packages should be backed by huge pages
+ */
+bool Go2::getRNFUseHugePages() const {
+	return m_rnf_use_huge_pages;
+}
+
 /******************************************************************************/
 /**
  * Allows to specify the offset with which the iteration counter should start. This is
@@ -66,6 +66,262 @@ GRandomBase::result_type GRandomBase::operator()() {
 	return this->int_random();
 }
 
+/******************************************************************************/
+/**
+ * Fills a range with "raw" random numbers. Depending on the derived class,
+ * the numbers are copied in bulk instead of being retrieved one by one.
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ */
+void GRandomBase::fill_raw(GRandomBase::result_type *out, std::size_t n) {
+	this->int_random_n(out, n);
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with uniformly distributed double values in the range [0,1[.
+ * Each value is assembled from two raw random numbers, so that the full
+ * 53 bit resolution of a double is used.
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ */
+void GRandomBase::fill_uniform01(double *out, std::size_t n) {
+	this->fill_uniform01_(out, n);
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with uniformly distributed float values in the range [0,1[
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ */
+void GRandomBase::fill_uniform01(float *out, std::size_t n) {
+	this->fill_uniform01_(out, n);
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with normally distributed double values, using the
+ * ziggurat method (see GZigguratNormalT.hpp).
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ * @param mu The mean of the distribution
+ * @param sigma The standard deviation of the distribution
+ */
+void GRandomBase::fill_normal(double *out, std::size_t n, double mu, double sigma) {
+	this->fill_normal_(out, n, mu, sigma);
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with normally distributed float values
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ * @param mu The mean of the distribution
+ * @param sigma The standard deviation of the distribution
+ */
+void GRandomBase::fill_normal(float *out, std::size_t n, float mu, float sigma) {
+	this->fill_normal_(out, n, mu, sigma);
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with 0/1 values, where 1 appears with probability p. Each
+ * value consumes a single raw random number.
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ * @param p The probability for a 1 to appear
+ */
+void GRandomBase::fill_bernoulli(std::uint8_t *out, std::size_t n, double p) {
+	// Raw numbers below the threshold result in a 1. Note that the threshold
+	// may exceed the range of result_type, so that p == 1 always yields 1.
+	std::uint64_t threshold = 0;
+	if(p >= 1.) {
+		threshold = static_cast<std::uint64_t>((GRandomBase::max)()) + 1;
+	} else if(p > 0.) {
+		threshold = static_cast<std::uint64_t>(p * (static_cast<double>((GRandomBase::max)()) + 1.));
+	}
+
+	std::array<GRandomBase::result_type, DEFAULTBULKCHUNKSIZE> raw{};
+	while(n > 0) {
+		std::size_t nChunk = (std::min)(n, DEFAULTBULKCHUNKSIZE);
+		this->int_random_n(raw.data(), nChunk);
+		for(std::size_t i=0; i<nChunk; i++) {
+			out[i] = static_cast<std::uint8_t>(static_cast<std::uint64_t>(raw[i]) < threshold);
+		}
+		out += nChunk;
+		n -= nChunk;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Fills a range of 64 bit words with independent bits, each of which is set
+ * with probability p. All 64 bits of a word are decided in parallel: a uniform
+ * number U in [0,1[ is compared digit by digit (most significant first) with the
+ * binary expansion of p, using one random bit per lane and digit. A lane is
+ * decided as soon as its digit differs from the one of p, so that on average
+ * only a handful of raw 64 bit random words are needed per output word,
+ * instead of one raw random number per bit.
+ *
+ * @param out The start of the range of words to be filled
+ * @param n The number of words to be filled in
+ * @param p The probability for a bit to be set
+ */
+void GRandomBase::fill_bernoulli_words(std::uint64_t *out, std::size_t n, double p) {
+	static_assert(
+		(G_BASE_GENERATOR::min)() == 0 && (G_BASE_GENERATOR::max)() == 0xFFFFFFFFu
+		, "fill_bernoulli_words() assumes 32 random bits per raw random number"
+	);
+
+	if(p <= 0.) {
+		std::fill(out, out + n, std::uint64_t(0));
+		return;
+	}
+
+	if(p >= 1.) {
+		std::fill(out, out + n, ~std::uint64_t(0));
+		return;
+	}
+
+	// The binary expansion of p as a 64 bit fixed point number
+	const auto threshold = static_cast<std::uint64_t>(std::ldexp(p, 64));
+
+	std::array<GRandomBase::result_type, DEFAULTBULKCHUNKSIZE> raw{};
+	std::size_t rawPos = raw.size();
+	auto next_word = [&]() -> std::uint64_t {
+		if(rawPos + 2 > raw.size()) {
+			this->int_random_n(raw.data(), raw.size());
+			rawPos = 0;
+		}
+		std::uint64_t r = (static_cast<std::uint64_t>(raw[rawPos]) << 32) | static_cast<std::uint64_t>(raw[rawPos + 1]);
+		rawPos += 2;
+		return r;
+	};
+
+	for(std::size_t i=0; i<n; i++) {
+		std::uint64_t word = 0;
+		std::uint64_t undecided = ~std::uint64_t(0);
+
+		for(int digit=63; digit>=0 && undecided; digit--) {
+			std::uint64_t r = next_word();
+			if((threshold >> digit) & std::uint64_t(1)) { // U < p for all undecided lanes with a 0-digit
+				word |= undecided & ~r;
+				undecided &= r;
+			} else { // U > p for all undecided lanes with a 1-digit
+				undecided &= ~r;
+			}
+		}
+
+		// Lanes that are still undecided have U == p and thus remain unset
+		out[i] = word;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Fills a range with uniformly distributed integer numbers. This default
+ * implementation simply calls int_random() repeatedly. Derived classes may
+ * overload this function in order to copy numbers in bulk.
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ */
+void GRandomBase::int_random_n(GRandomBase::result_type *out, std::size_t n) {
+	for(std::size_t i=0; i<n; i++) {
+		out[i] = this->int_random();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Common implementation of fill_uniform01() for float and double
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ */
+template<typename fp_type>
+void GRandomBase::fill_uniform01_(fp_type *out, std::size_t n) {
+	static_assert(
+		std::is_same<fp_type, double>::value || std::is_same<fp_type, float>::value
+		, "fill_uniform01_ is only available for float and double"
+	);
+
+	// The number of raw values needed for a single floating point value
+	const std::size_t N_RAW = std::is_same<fp_type, double>::value ? 2 : 1;
+
+	std::array<GRandomBase::result_type, DEFAULTBULKCHUNKSIZE> raw{};
+	while(n > 0) {
+		std::size_t nChunk = (std::min)(n, DEFAULTBULKCHUNKSIZE / N_RAW);
+		this->int_random_n(raw.data(), N_RAW * nChunk);
+
+		if(std::is_same<fp_type, double>::value) {
+			// 27 + 26 bits, compare genrand_res53() of the reference Mersenne Twister
+			for(std::size_t i=0; i<nChunk; i++) {
+				out[i] = static_cast<fp_type>(
+					(static_cast<double>(raw[2*i] >> 5) * 67108864. + static_cast<double>(raw[2*i+1] >> 6))
+					* (1. / 9007199254740992.)
+				);
+			}
+		} else {
+			// 24 bits
+			for(std::size_t i=0; i<nChunk; i++) {
+				out[i] = static_cast<fp_type>(raw[i] >> 8) * (fp_type(1) / fp_type(16777216));
+			}
+		}
+
+		out += nChunk;
+		n -= nChunk;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Common implementation of fill_normal() for float and double. Raw numbers
+ * are retrieved in bulk. A first, branch-free pass calculates the fast-path
+ * candidates of the ziggurat for the entire chunk and records whether they
+ * were accepted. A second pass replaces the (~1%) rejected candidates, using
+ * the slow path with further numbers drawn from this object.
+ *
+ * @param out The start of the range to be filled
+ * @param n The number of items to be filled in
+ * @param mu The mean of the distribution
+ * @param sigma The standard deviation of the distribution
+ */
+template<typename fp_type>
+void GRandomBase::fill_normal_(fp_type *out, std::size_t n, fp_type mu, fp_type sigma) {
+	const ziggurat_tables& t = ziggurat_normal_tables();
+	const std::size_t N_CHUNK = DEFAULTBULKCHUNKSIZE / 2;
+
+	std::array<GRandomBase::result_type, DEFAULTBULKCHUNKSIZE> raw{};
+	std::array<std::uint8_t, DEFAULTBULKCHUNKSIZE / 2> accepted{};
+
+	while(n > 0) {
+		std::size_t nChunk = (std::min)(n, N_CHUNK);
+		this->int_random_n(raw.data(), 2 * nChunk);
+
+		for(std::size_t i=0; i<nChunk; i++) {
+			accepted[i] = static_cast<std::uint8_t>(ziggurat_accepts(raw[2*i], raw[2*i+1], t));
+			out[i] = static_cast<fp_type>(mu + sigma * ziggurat_candidate(raw[2*i], raw[2*i+1], t));
+		}
+
+		for(std::size_t i=0; i<nChunk; i++) {
+			if(not accepted[i]) {
+				out[i] = static_cast<fp_type>(mu + sigma * ziggurat_fix(raw[2*i], raw[2*i+1], *this, t));
+			}
+		}
+
+		out += nChunk;
+		n -= nChunk;
+	}
+}
+
 /******************************************************************************/
 
 } /* namespace Hap */
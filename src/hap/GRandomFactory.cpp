@@ -36,9 +36,72 @@
 
 #include "hap/GRandomFactory.hpp"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace Gem {
 namespace Hap {
 
+/******************************************************************************/
+/**
+ * Allocates storage for n random numbers. The storage is aligned to a cache
+ * line. If huge pages were requested and the storage is at least as large as
+ * a huge page, it is aligned to huge page boundaries and the operating system
+ * is asked to back it with huge pages (currently only on Linux). hugePages
+ * is reset to false if huge pages could not be used.
+ *
+ * @param n The number of random numbers to be stored
+ * @param hugePages Indicates whether huge pages should be used; holds the actual choice on return
+ * @return A pointer to the storage
+ */
+G_BASE_GENERATOR::result_type *acquire_random_storage(std::size_t n, bool &hugePages) {
+	std::size_t nBytes = n*sizeof(G_BASE_GENERATOR::result_type);
+
+	std::size_t alignment = RANDOMSTORAGEALIGNMENT;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	if(hugePages && nBytes >= RANDOMHUGEPAGESIZE) {
+		alignment = RANDOMHUGEPAGESIZE;
+	} else {
+		hugePages = false;
+	}
+#else
+	hugePages = false;
+#endif
+
+	// aligned allocation requires the size to be a multiple of the alignment
+	nBytes = ((nBytes + alignment - 1)/alignment)*alignment;
+
+#ifdef _MSC_VER
+	void *p = _aligned_malloc(nBytes, alignment);
+#else
+	void *p = std::aligned_alloc(alignment, nBytes);
+#endif
+	if(not p) throw std::bad_alloc();
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	if(hugePages && 0 != madvise(p, nBytes, MADV_HUGEPAGE)) {
+		hugePages = false;
+	}
+#endif
+
+	return static_cast<G_BASE_GENERATOR::result_type *>(p);
+}
+
+/******************************************************************************/
+/**
+ * Releases storage obtained from acquire_random_storage()
+ *
+ * @param p A pointer to the storage
+ */
+void release_random_storage(G_BASE_GENERATOR::result_type *p) noexcept {
+#ifdef _MSC_VER
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -116,14 +179,62 @@ void GRandomFactory::finalize() {
 	m_finalized.store(true);
 }
 
+/******************************************************************************/
+/**
+ * Sets the number of random numbers in newly created packages. Fresh packages
+ * waiting in the global buffer are discarded, so that the new size takes effect
+ * promptly. Fresh packages held in thread-local caches or still being filled
+ * carry an outdated generation number and are discarded when they are taken
+ * out of the cache. Packages of the old size that have already been handed out
+ * remain valid. They are replaced by packages of the new size when they are recycled.
+ *
+ * @param arraySize The number of random numbers in newly created packages
+ */
+void GRandomFactory::setArraySize(std::size_t arraySize) {
+	if(0 == arraySize) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GRandomFactory::setArraySize(): Error!" << std::endl
+				<< "Random number packages may not be empty" << std::endl
+		);
+	}
+
+	if(arraySize == m_array_size.exchange(arraySize)) return;
+	// Note that the size is stored before the generation is incremented
+	m_array_generation++;
+
+	std::vector<std::unique_ptr<random_container>> outdated;
+	m_p_fresh_bfr.try_pop_n_move(outdated, (std::numeric_limits<std::size_t>::max)());
+}
+
 /******************************************************************************/
 /**
  * Allows to retrieve the size of random number arrays
  *
- * @return The current value of the arraySize_ variable
+ * @return The current value of the m_array_size variable
  */
 std::size_t GRandomFactory::getCurrentArraySize() const {
-	return DEFAULTARRAYSIZE;
+	return m_array_size;
+}
+
+/******************************************************************************/
+/**
+ * Sets the maximum number of packages held in the buffers of fresh and of
+ * recycled packages.
+ *
+ * @param bufferSize The maximum number of packages held in each buffer
+ */
+void GRandomFactory::setBufferSize(std::size_t bufferSize) {
+	if(0 == bufferSize) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GRandomFactory::setBufferSize(): Error!" << std::endl
+				<< "The buffer size must be at least 1" << std::endl
+		);
+	}
+
+	m_p_fresh_bfr.setCapacity(bufferSize);
+	m_p_ret_bfr.setCapacity(bufferSize);
 }
 
 /******************************************************************************/
@@ -134,7 +245,31 @@ std::size_t GRandomFactory::getCurrentArraySize() const {
  * @return The size of the random buffer
  */
 std::size_t GRandomFactory::getBufferSize() const {
-	return DEFAULTFACTORYBUFFERSIZE;
+	return m_p_fresh_bfr.getCapacity();
+}
+
+/******************************************************************************/
+/**
+ * Specifies whether the storage of newly created packages should be backed
+ * by huge pages. This only has an effect for packages at least as large as
+ * a huge page (RANDOMHUGEPAGESIZE), and only on operating systems supporting
+ * this feature.
+ *
+ * @param useHugePages Whether new packages should be backed by huge pages
+ */
+void GRandomFactory::setUseHugePages(bool useHugePages) {
+	m_use_huge_pages = useHugePages;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the storage of newly created packages should be backed by
+ * huge pages
+ *
+ * @return Whether new packages should be backed by huge pages
+ */
+bool GRandomFactory::getUseHugePages() const {
+	return m_use_huge_pages;
 }
 
 /******************************************************************************/
@@ -162,16 +297,22 @@ seed_type GRandomFactory::getSeed() {
 /******************************************************************************/
 /**
  * Allows recycling of (possibly partially used) packages. This way we avoid
- * the continuous allocation and deletion of new buffers. Note that this function
- * may delete its argument if it cannot be added to the buffer.
+ * the continuous allocation and deletion of new buffers. Packages are collected
+ * in a thread-local cache and handed to the m_p_ret_bfr buffer in batches. Note
+ * that this function may delete its argument if it cannot be added to the buffer.
  *
- * @param r A pointer to a partially used work package
- * @param current_pos The first position in the array that holds unused random numbers
+ * @param p A pointer to a partially used work package
  */
 void GRandomFactory::returnUsedPackage(std::unique_ptr<random_container>&& p) {
-	// We try to add the item to the m_p_ret_bfr queue.
-	if(not m_p_ret_bfr.try_push_move(std::move(p))) {
-		p.reset();
+	thread_cache& cache = localCache();
+	cache.used.push_back(std::move(p));
+
+	if(cache.used.size() >= 2*DEFAULTFACTORYCACHESIZE) {
+		// Hand over as many packages as will fit, keep a few for local refills
+		m_p_ret_bfr.try_push_n_move(cache.used);
+		if(cache.used.size() > DEFAULTFACTORYCACHESIZE) {
+			cache.used.resize(DEFAULTFACTORYCACHESIZE);
+		}
 	}
 }
 
@@ -261,7 +402,10 @@ void GRandomFactory::setNProducerThreads(const std::uint16_t &nProducerThreads)
  * When objects need a new container of [0,1[ -random numbers with the current
  * default size, they call this function. See also
  * http://preshing.com/20130930/double-checked-locking-is-fixed-in-cpp11/ for
- * the rationale.
+ * the rationale. Fresh packages are taken in batches from the global buffer
+ * and stored in a thread-local cache. If the global buffer has run empty, a
+ * package is filled in the calling thread instead, so that this function
+ * never waits for the producer threads.
  *
  * @return A packet of new [0,1[ random numbers
  */
@@ -282,18 +426,87 @@ std::unique_ptr<random_container> GRandomFactory::getNewRandomContainer() {
 		}
 	}
 
-	std::unique_ptr<random_container> p; // empty
-	if(not m_p_fresh_bfr.pop_and_wait_move(
-		p
-		, std::chrono::milliseconds(DEFAULTFACTORYGETWAIT))) {
-		// nothing - our way of signaling a time out
-		// is to return an empty std::unique_ptr
-		p = std::unique_ptr<random_container>();
+	thread_cache& cache = localCache();
+	std::uint64_t generation = m_array_generation.load();
+
+	while(true) {
+		if(cache.fresh.empty()) {
+			// Removing packages from the buffer wakes up producers
+			m_p_fresh_bfr.try_pop_n_move(cache.fresh, DEFAULTFACTORYCACHESIZE);
+		}
+
+		if(cache.fresh.empty()) {
+			return fillLocally(cache);
+		}
+
+		std::unique_ptr<random_container> p = std::move(cache.fresh.back());
+		cache.fresh.pop_back();
+
+		// Packages filled before the last call to setArraySize() are discarded
+		if(p->generation() == generation) {
+			return p;
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * Gives access to the package cache of the calling thread. The cache is
+ * independent of the factory object, as packages only hold random numbers.
+ * Left-over packages are deleted when the thread terminates.
+ *
+ * @return The package cache of the calling thread
+ */
+GRandomFactory::thread_cache& GRandomFactory::localCache() {
+	static thread_local thread_cache cache;
+	return cache;
+}
+
+/******************************************************************************/
+/**
+ * Fills a package in the calling thread, recycling a used package if one is
+ * available in the local cache. The local generator is seeded upon first use.
+ *
+ * @param cache The package cache of the calling thread
+ * @return A package of fresh random numbers
+ */
+std::unique_ptr<random_container> GRandomFactory::fillLocally(thread_cache& cache) {
+	if(not cache.gen) {
+		cache.gen.reset(new G_BASE_GENERATOR(this->getSeed()));
+	}
+
+	std::unique_ptr<random_container> p;
+	if(not cache.used.empty()) {
+		p = std::move(cache.used.back());
+		cache.used.pop_back();
 	}
+	refill(p, *cache.gen);
 
 	return p;
 }
 
+/******************************************************************************/
+/**
+ * Refreshes the random numbers of a recycled package. Empty pointers and
+ * packages whose size differs from the current array size are replaced by
+ * a new package. The package is tagged with the generation number read
+ * before the array size, so that it never claims a newer generation than
+ * its size.
+ *
+ * @param p The package to be refreshed
+ * @param rng The generator used for the production of random numbers
+ */
+void GRandomFactory::refill(std::unique_ptr<random_container>& p, G_BASE_GENERATOR& rng) const {
+	std::uint64_t generation = m_array_generation.load();
+	std::size_t arraySize = m_array_size.load();
+	if(p && p->size() == arraySize) {
+		p->refresh(rng);
+	} else {
+		p.reset(new random_container(arraySize, m_use_huge_pages.load(), rng));
+	}
+	p->m_generation = generation;
+}
+
 /******************************************************************************/
 /**
  * The production of [0,1[ random numbers takes place here. As this function
@@ -307,11 +520,18 @@ void GRandomFactory::producer(std::uint32_t seed) {
 	try {
 		G_BASE_GENERATOR mt(seed);
 		std::unique_ptr<random_container> p;
+		std::vector<std::unique_ptr<random_container>> recycled;
 
 		while(not m_threads_stop_requested) {
-			// First we try to retrieve a "recycled" item from the m_p_ret_bfr buffer. If this
-			// fails (likely because the buffer is empty), we create a new item instead
-			if(m_p_ret_bfr.try_pop_move(p)) {
+			// First we try to retrieve a "recycled" item from the m_p_ret_bfr buffer (in batches).
+			// If this fails (likely because the buffer is empty), we create a new item instead
+			if(recycled.empty()) {
+				m_p_ret_bfr.try_pop_n_move(recycled, DEFAULTFACTORYCACHESIZE);
+			}
+
+			if(not recycled.empty()) {
+				p = std::move(recycled.back());
+				recycled.pop_back();
 
 				// If we reach this line, we have successfully retrieved a recycled container.
 				// First do some error-checking
@@ -326,10 +546,11 @@ void GRandomFactory::producer(std::uint32_t seed) {
 
 #endif /* DEBUG */
 
-				// Replace "used" random numbers with new ones
-				p->refresh(mt);
+				// Replace "used" random numbers with new ones (or replace outdated containers)
+				this->refill(p, mt);
 			} else { // O.k., so we need to create a new container
-				p.reset(new random_container(mt));
+				p.reset();
+				this->refill(p, mt);
 			}
 
 			// Try to submit the item and check for termination conditions along the way
@@ -345,7 +566,12 @@ void GRandomFactory::producer(std::uint32_t seed) {
 						);
 					}
 #endif
-					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+					// Sleep until consumers have taken packages from the buffer. We wake up
+					// regularly in order to check for termination requests
+					m_p_fresh_bfr.wait_for_size_at_most(
+						m_p_fresh_bfr.getCapacity() - 1
+						, std::chrono::milliseconds(DEFAULTFACTORYPUTWAIT)
+					);
 					continue;
 				} else { // We have submitted the item -- stop the inner loop
 					break;
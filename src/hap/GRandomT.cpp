@@ -39,6 +39,60 @@
 namespace Gem {
 namespace Hap {
 
+/******************************************************************************/
+/**
+ * Returns the process-wide seed used by GRandomT<RANDOMCOUNTER> objects. It is
+ * assembled from two seeds of the global random factory upon the first call
+ * and remains constant afterwards. Note that no producer threads are started
+ * by this call.
+ *
+ * @return The process-wide seed of the counter-based generators
+ */
+std::uint64_t counterRandomSeed() {
+	static const std::uint64_t seed
+		= (static_cast<std::uint64_t>(GRANDOMFACTORY->getSeed()) << 32)
+		  | static_cast<std::uint64_t>(GRANDOMFACTORY->getSeed());
+	return seed;
+}
+
+/******************************************************************************/
+/**
+ * Hands out a new stream id. The upper 32 bit hold a process-wide index, the
+ * lower 32 bit count the streams handed out with this index. Each thread is
+ * assigned an index upon its first call and moves on to a fresh index once it
+ * has handed out 2^32 streams, so that no stream id is ever handed out twice.
+ * Apart from the assignment of indices, no synchronization between threads
+ * takes place.
+ *
+ * @return A stream id unique for this process
+ */
+std::uint64_t nextCounterRandomStream() {
+	static std::atomic<std::uint64_t> n_indices{0};
+
+	// Assigns a fresh index to the calling thread
+	auto nextIndex = []() -> std::uint64_t {
+		std::uint64_t index = n_indices++;
+		if(index > 0xFFFFFFFFu) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In nextCounterRandomStream(): Error!" << std::endl
+					<< "All 2^64 stream ids of this process have been handed out" << std::endl
+			);
+		}
+		return index;
+	};
+
+	thread_local std::uint64_t thread_index = nextIndex();
+	thread_local std::uint64_t n_streams = 0;
+
+	if(n_streams > 0xFFFFFFFFu) { // All streams of the current index are used up
+		thread_index = nextIndex();
+		n_streams = 0;
+	}
+
+	return (thread_index << 32) | n_streams++;
+}
+
 /******************************************************************************/
 
 // thread_local Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> GRANDOM_TLS;
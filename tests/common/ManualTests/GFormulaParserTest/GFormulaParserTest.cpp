@@ -133,6 +133,29 @@ int test_main(int argc, char** const argv) {
 		BOOST_CHECK_CLOSE(parse_val, fp_val, 0.001);
 	}
 
+	{ // Test evaluation through variable slots
+		std::string formula("sin({{var0[2]}})/{{var1}} + {{var0[2]}}*{{var1[0]}}");
+
+		GFormulaParserT<double> f(formula);
+
+		// {{var1}} and {{var1[0]}} share a slot, as do both occurrences of {{var0[2]}}
+		BOOST_CHECK(f.getVariableSlots().size() == 2);
+		BOOST_CHECK(std::get<0>(f.getVariableSlots().at(0)) == "var0");
+		BOOST_CHECK(std::get<1>(f.getVariableSlots().at(0)) == 2);
+		BOOST_CHECK(std::get<0>(f.getVariableSlots().at(1)) == "var1");
+		BOOST_CHECK(std::get<1>(f.getVariableSlots().at(1)) == 0);
+
+		// Repeated evaluations re-use the compiled formula
+		for(double x = 0.5; x < 3.; x += 0.5) {
+			std::vector<double> slotValues = boost::assign::list_of(x)(8.98989898989899);
+
+			double fp_val = sin(x)/8.98989898989899 + x*8.98989898989899;
+			double parse_val = f.evaluate(slotValues);
+
+			BOOST_CHECK_CLOSE(parse_val, fp_val, 0.001);
+		}
+	}
+
 	{ // Test replacement of variables and constants (2)
 		std::map<std::string, std::vector<double>> parameterValues;
 		std::map<std::string, double> userConstants;
@@ -53,6 +53,7 @@ using namespace boost::unit_test;
 #include "geneva/GInt32GaussAdaptor.hpp"
 #include "geneva/GDoubleBiGaussAdaptor.hpp"
 #include "geneva/GDoubleGaussAdaptor.hpp"
+#include "geneva/GFloatGaussAdaptor.hpp"
 #include "geneva/GBooleanObjectCollection.hpp"
 #include "geneva/GInt32ObjectCollection.hpp"
 #include "geneva/GDoubleObjectCollection.hpp"
@@ -66,6 +67,7 @@ using namespace boost::unit_test;
 #include "geneva/GConstrainedDoubleObject.hpp"
 #include "geneva/GInt32Collection.hpp"
 #include "geneva/GDoubleCollection.hpp"
+#include "geneva/GFloatCollection.hpp"
 #include "geneva/GBooleanCollection.hpp"
 #include "geneva/G_OptimizationAlgorithm_GradientDescent_PersonalityTraits.hpp"
 #include "geneva/G_OptimizationAlgorithm_ParameterScan_PersonalityTraits.hpp"
@@ -78,6 +80,9 @@ using namespace boost::unit_test;
 #include "geneva-individuals/GExternalEvaluatorIndividual.hpp"
 
 #include "geneva/tests/Geneva_tests.hpp"
+#include "geneva/tests/GRecombination_tests.hpp"
+#include "geneva/tests/GReproducibleStreams_tests.hpp"
+#include "geneva/tests/GValidityChecks_tests.hpp"
 
 using namespace Gem::Geneva;
 
@@ -98,6 +103,7 @@ public:
 			, GInt32GaussAdaptor
 			, GDoubleBiGaussAdaptor
 			, GDoubleGaussAdaptor
+			, GFloatGaussAdaptor
 		>;
 
 		using data_types = boost::mpl::list<
@@ -120,6 +126,7 @@ public:
 		using pod_collection_types = boost::mpl::list<
 			GInt32Collection
 			, GDoubleCollection
+			, GFloatCollection
 			, GBooleanCollection
 			, GConstrainedDoubleCollection
 		>;
@@ -158,6 +165,10 @@ public:
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, pod_collection_types ) );
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, pod_collection_types ) );
 
+		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_loadValues, data_types ) );
+		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_loadValues, object_collection_types ) );
+		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_loadValues, pod_collection_types ) );
+
 		// add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, algorithm_types ) );
 		// add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, algorithm_types ) );
 
@@ -166,6 +177,28 @@ public:
 
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, individual_types ) );
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, individual_types ) );
+
+		/*****************************************************************************************/
+
+		boost::shared_ptr<Gem::Geneva::Tests::GReproducibleStreams_tests> reproducibleStreams_instance(
+			new Gem::Geneva::Tests::GReproducibleStreams_tests()
+		);
+		add( BOOST_CLASS_TEST_CASE( &Gem::Geneva::Tests::GReproducibleStreams_tests::no_failure_expected, reproducibleStreams_instance ) );
+
+		/*****************************************************************************************/
+
+		boost::shared_ptr<Gem::Geneva::Tests::GRecombination_tests> recombination_instance(
+			new Gem::Geneva::Tests::GRecombination_tests()
+		);
+		add( BOOST_CLASS_TEST_CASE( &Gem::Geneva::Tests::GRecombination_tests::no_failure_expected, recombination_instance ) );
+
+		/*****************************************************************************************/
+
+		boost::shared_ptr<Gem::Geneva::Tests::GValidityChecks_tests> validityChecks_instance(
+			new Gem::Geneva::Tests::GValidityChecks_tests()
+		);
+		add( BOOST_CLASS_TEST_CASE( &Gem::Geneva::Tests::GValidityChecks_tests::no_failure_expected, validityChecks_instance ) );
+		add( BOOST_CLASS_TEST_CASE( &Gem::Geneva::Tests::GValidityChecks_tests::failures_expected, validityChecks_instance ) );
 	}
 
     G_API_GENEVA ~GenevaStandardTestSuite() {
@@ -0,0 +1,363 @@
+/**
+ * @file GRandomBenchmark.cpp
+ */
+
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+
+// Standard header files go here
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+// Boost header files go here
+#include <boost/algorithm/string.hpp>
+
+// Geneva header files go here
+#include "hap/GRandomT.hpp"
+#include "hap/GRandomDistributionsT.hpp"
+#include "hap/GZigguratNormalT.hpp"
+#include "common/GParserBuilder.hpp"
+
+/******************************************************************************/
+/**
+ * This program measures the throughput of the random number generators of the
+ * Hap library for different distributions, generator flavours, numbers of
+ * consumer threads and numbers of producer threads of the random number factory.
+ * Results are emitted in JSON format, so they may be compared across machines
+ * and builds. For the proxy flavour, different package sizes of the factory
+ * may be measured as well. Note that the number of producer threads of the factory can only
+ * grow while the factory is running, so producer settings are measured in
+ * ascending order.
+ */
+
+/******************************************************************************/
+/**
+ * Holds the result of a single measurement
+ */
+struct measurement {
+	std::string flavour;
+	std::size_t arraySize;
+	std::uint16_t nProducerThreads;
+	std::uint16_t nConsumerThreads;
+	std::string distribution;
+	std::uint64_t nNumbers;
+	double seconds;
+};
+
+/******************************************************************************/
+/**
+ * Lets nConsumerThreads threads draw nDraws random numbers each from their own
+ * random number generator, using a copy of the distribution dist. Only the
+ * drawing of random numbers is timed, construction of the generators is not.
+ *
+ * @return The wall-clock time needed by all threads to draw their numbers
+ */
+template <Gem::Hap::RANDFLAVOURS flavour, typename dist_type>
+double timeDraws(
+	dist_type const& dist
+	, std::uint16_t nConsumerThreads
+	, std::uint32_t nDraws
+) {
+	std::atomic<std::uint16_t> nReady(0);
+	std::atomic<bool> go(false);
+	std::atomic<double> sink(0.);
+
+	std::vector<std::thread> consumers;
+	for(std::uint16_t t=0; t<nConsumerThreads; t++) {
+		consumers.emplace_back(
+			[&]() {
+				Gem::Hap::GRandomT<flavour> gr;
+				dist_type d(dist);
+
+				nReady++;
+				while(not go.load()) { std::this_thread::yield(); }
+
+				double sum = 0.;
+				for(std::uint32_t i=0; i<nDraws; i++) {
+					sum += static_cast<double>(d(gr));
+				}
+
+				// Prevent the compiler from optimizing the loop away
+				double expected = sink.load();
+				while(not sink.compare_exchange_weak(expected, expected + sum)) { /* nothing */ }
+			}
+		);
+	}
+
+	while(nReady.load() < nConsumerThreads) { std::this_thread::yield(); }
+
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	go.store(true);
+	for(auto& c: consumers) { c.join(); }
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+	return duration.count();
+}
+
+/******************************************************************************/
+/**
+ * Measures all distributions for a given generator flavour and number of threads
+ */
+template <Gem::Hap::RANDFLAVOURS flavour>
+void measureFlavour(
+	std::string const& flavourName
+	, std::uint16_t nProducerThreads
+	, std::uint16_t nConsumerThreads
+	, std::uint32_t nDraws
+	, std::vector<measurement>& results
+) {
+	std::vector<std::tuple<std::string, std::function<double()>>> benchmarks {
+		std::make_tuple(
+			std::string("uniform")
+			, [&]() { return timeDraws<flavour>(std::uniform_real_distribution<double>(0., 1.), nConsumerThreads, nDraws); }
+		)
+		, std::make_tuple(
+			std::string("normal")
+			, [&]() { return timeDraws<flavour>(Gem::Hap::ziggurat_normal_distribution<double>(0., 1.), nConsumerThreads, nDraws); }
+		)
+		, std::make_tuple(
+			std::string("bi_normal")
+			, [&]() { return timeDraws<flavour>(Gem::Hap::bi_normal_distribution<double>(0., 1., 1., 2.), nConsumerThreads, nDraws); }
+		)
+		, std::make_tuple(
+			std::string("bernoulli")
+			, [&]() { return timeDraws<flavour>(std::bernoulli_distribution(0.5), nConsumerThreads, nDraws); }
+		)
+	};
+
+	for(auto const& b: benchmarks) {
+		double seconds = std::get<1>(b)();
+		results.push_back(measurement{
+			flavourName
+			, GRANDOMFACTORY->getCurrentArraySize()
+			, nProducerThreads
+			, nConsumerThreads
+			, std::get<0>(b)
+			, static_cast<std::uint64_t>(nConsumerThreads)*nDraws
+			, seconds
+		});
+
+		std::cerr
+			<< flavourName << " / " << GRANDOMFACTORY->getCurrentArraySize() << " numbers per package / "
+			<< nProducerThreads << " producers / "
+			<< nConsumerThreads << " consumers / " << std::get<0>(b) << ": "
+			<< seconds << " s" << std::endl;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Converts a comma-separated list of numbers into a sorted vector
+ */
+template <typename num_type>
+std::vector<num_type> toSortedList(std::string const& list) {
+	std::vector<std::string> tokens;
+	boost::split(tokens, list, boost::is_any_of(","), boost::token_compress_on);
+
+	std::vector<num_type> result;
+	for(auto const& t: tokens) {
+		std::string token = boost::trim_copy(t);
+		if(not token.empty()) result.push_back(boost::lexical_cast<num_type>(token));
+	}
+	std::sort(result.begin(), result.end());
+
+	return result;
+}
+
+/******************************************************************************/
+/**
+ * Emits the results in JSON format
+ */
+void writeJSON(
+	std::ostream& out
+	, std::uint32_t nDraws
+	, std::vector<measurement> const& results
+) {
+	out
+		<< "{" << std::endl
+		<< "  \"benchmark\": \"GRandomBenchmark\"," << std::endl
+		<< "  \"factory_buffer_size\": " << GRANDOMFACTORY->getBufferSize() << "," << std::endl
+		<< "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << "," << std::endl
+		<< "  \"draws_per_thread\": " << nDraws << "," << std::endl
+		<< "  \"results\": [" << std::endl;
+
+	for(std::size_t i=0; i<results.size(); i++) {
+		measurement const& m = results[i];
+		out
+			<< "    {"
+			<< "\"flavour\": \"" << m.flavour << "\""
+			<< ", \"array_size\": " << m.arraySize
+			<< ", \"producer_threads\": " << m.nProducerThreads
+			<< ", \"consumer_threads\": " << m.nConsumerThreads
+			<< ", \"distribution\": \"" << m.distribution << "\""
+			<< ", \"numbers\": " << m.nNumbers
+			<< ", \"seconds\": " << m.seconds
+			<< ", \"numbers_per_second\": " << double(m.nNumbers)/m.seconds
+			<< ", \"ns_per_number\": " << 1.e9*m.seconds*double(m.nConsumerThreads)/double(m.nNumbers)
+			<< "}" << (i+1<results.size()?",":"") << std::endl;
+	}
+
+	out
+		<< "  ]" << std::endl
+		<< "}" << std::endl;
+}
+
+/******************************************************************************/
+
+int main(int argc, char **argv) {
+	std::string flavours = "proxy,local,counter";
+	std::string producerThreads = "2";
+	std::string arraySizes = boost::lexical_cast<std::string>(Gem::Hap::DEFAULTARRAYSIZE);
+	std::uint16_t maxConsumerThreads = static_cast<std::uint16_t>((std::max)(1u, std::thread::hardware_concurrency()));
+	std::uint32_t nDraws = 1000000;
+	std::string outputFile = "";
+
+	//----------------------------------------------------------------
+	// Create the parser builder
+	Gem::Common::GParserBuilder gpb;
+
+	// Specify command line options
+	gpb.registerCLParameter<std::string>(
+		"flavours,f"
+		, flavours // the variable to be filled
+		, flavours // the default
+		, "A comma-separated list of generator flavours to be measured (proxy, local, counter)"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"producerThreads,n"
+		, producerThreads // the variable to be filled
+		, producerThreads // the default
+		, "A comma-separated list of producer thread counts of the random number factory"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"arraySizes,a"
+		, arraySizes // the variable to be filled
+		, arraySizes // the default
+		, "A comma-separated list of package sizes of the random number factory"
+	);
+
+	gpb.registerCLParameter<std::uint16_t>(
+		"maxConsumerThreads,t"
+		, maxConsumerThreads // the variable to be filled
+		, maxConsumerThreads // the default
+		, "Measurements are done for 1, 2, 4, ... consumer threads up to this number"
+	);
+
+	gpb.registerCLParameter<std::uint32_t>(
+		"draws,d"
+		, nDraws // the variable to be filled
+		, nDraws // the default
+		, "The number of random numbers drawn by each consumer thread"
+	);
+
+	gpb.registerCLParameter<std::string>(
+		"output,o"
+		, outputFile // the variable to be filled
+		, outputFile // the default
+		, "The name of a file to which the JSON output is written. Empty means: stdout"
+	);
+
+	// Parse the command line and leave if the help flag was given
+	if(Gem::Common::GCL_HELP_REQUESTED == gpb.parseCommandLine(argc, argv, false /*verbose -- stdout is reserved for the JSON output*/)) {
+		return 0;
+	}
+
+	//----------------------------------------------------------------
+	// Assemble the consumer thread counts (1, 2, 4, ... plus the maximum)
+
+	std::vector<std::uint16_t> consumerThreads;
+	for(std::uint16_t t=1; t<maxConsumerThreads; t*=2) consumerThreads.push_back(t);
+	consumerThreads.push_back((std::max)(std::uint16_t(1), maxConsumerThreads));
+
+	std::vector<std::string> flavourList;
+	boost::split(flavourList, flavours, boost::is_any_of(","), boost::token_compress_on);
+
+	//----------------------------------------------------------------
+	// Run the measurements
+
+	std::vector<measurement> results;
+
+	// Generators not depending on the factory are measured first
+	for(auto const& flavour: flavourList) {
+		for(auto nConsumerThreads: consumerThreads) {
+			if("local" == flavour) {
+				measureFlavour<Gem::Hap::RANDFLAVOURS::RANDOMLOCAL>(flavour, 0, nConsumerThreads, nDraws, results);
+			} else if("counter" == flavour) {
+				measureFlavour<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>(flavour, 0, nConsumerThreads, nDraws, results);
+			} else if("proxy" != flavour) {
+				std::cerr << "Ignoring unknown flavour " << flavour << std::endl;
+				break;
+			}
+		}
+	}
+
+	// The proxy depends on the number of producer threads in the factory
+	if(std::find(flavourList.begin(), flavourList.end(), "proxy") != flavourList.end()) {
+		for(auto nProducerThreads: toSortedList<std::uint16_t>(producerThreads)) {
+			GRANDOMFACTORY->setNProducerThreads(nProducerThreads);
+			for(auto arraySize: toSortedList<std::size_t>(arraySizes)) {
+				GRANDOMFACTORY->setArraySize(arraySize);
+				for(auto nConsumerThreads: consumerThreads) {
+					measureFlavour<Gem::Hap::RANDFLAVOURS::RANDOMPROXY>("proxy", nProducerThreads, nConsumerThreads, nDraws, results);
+				}
+			}
+		}
+	}
+
+	//----------------------------------------------------------------
+	// Let the audience know
+
+	if(outputFile.empty()) {
+		writeJSON(std::cout, nDraws, results);
+	} else {
+		std::ofstream out(outputFile);
+		writeJSON(out, nDraws, results);
+	}
+
+	return 0;
+}